@@ -0,0 +1,286 @@
+#include "FrameStats.h"
+#include "Log.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+// ============================================================================
+// FFrameTimeHistogram Implementation
+// ============================================================================
+
+uint64_t FFrameTimeHistogram::GetBucketLowerBoundUS(uint32_t index) {
+    constexpr uint32_t subBucketBits = FrameStatsDetail::SUB_BUCKET_BITS;
+    if (index < (1u << subBucketBits)) {
+        return index;
+    }
+
+    // index = (shift << bits) + top, with top in [2^bits, 2^(bits+1))
+    uint32_t shift = (index >> subBucketBits) - 1;
+    uint64_t top = (index & ((1u << subBucketBits) - 1)) + (1u << subBucketBits);
+    return top << shift;
+}
+
+uint64_t FFrameTimeHistogram::GetBucketUpperBoundUS(uint32_t index) {
+    constexpr uint32_t subBucketBits = FrameStatsDetail::SUB_BUCKET_BITS;
+    if (index < (1u << subBucketBits)) {
+        return index;
+    }
+
+    uint32_t shift = (index >> subBucketBits) - 1;
+    uint64_t top = (index & ((1u << subBucketBits) - 1)) + (1u << subBucketBits);
+    return ((top + 1) << shift) - 1;
+}
+
+void FFrameTimeHistogram::Add(uint64_t valueUS) {
+    counts[GetBucketIndex(valueUS)]++;
+    totalCount++;
+}
+
+void FFrameTimeHistogram::Remove(uint64_t valueUS) {
+    uint64_t& count = counts[GetBucketIndex(valueUS)];
+    if (count > 0) {
+        count--;
+        totalCount--;
+    }
+}
+
+void FFrameTimeHistogram::Reset() {
+    counts.fill(0);
+    totalCount = 0;
+}
+
+uint64_t FFrameTimeHistogram::GetValueAtPercentileUS(double percentile) const {
+    if (totalCount == 0) {
+        return 0;
+    }
+
+    // Rank of the sample at the percentile (nearest-rank method)
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(totalCount)));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t cumulative = 0;
+    for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+        cumulative += counts[i];
+        if (cumulative >= rank) {
+            return std::min(GetBucketUpperBoundUS(i), MAX_TRACKABLE_US);
+        }
+    }
+    return MAX_TRACKABLE_US;
+}
+
+// ============================================================================
+// FFrameStats Implementation
+// ============================================================================
+
+namespace {
+
+uint32_t ToMicroseconds(double seconds) {
+    double microseconds = std::round(seconds * 1000000.0);
+    if (microseconds <= 0.0) {
+        return 0;
+    }
+    if (microseconds >= static_cast<double>(std::numeric_limits<uint32_t>::max())) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    return static_cast<uint32_t>(microseconds);
+}
+
+double ToMilliseconds(uint64_t microseconds) {
+    return static_cast<double>(microseconds) / 1000.0;
+}
+
+// Percentiles come from bucket bounds: clamp them to the exact extremes
+void FillPercentiles(FFrameTimeSummary& summary, const FFrameTimeHistogram& histogram) {
+    auto percentileMS = [&](double percentile) {
+        double value = ToMilliseconds(histogram.GetValueAtPercentileUS(percentile));
+        return std::min(std::max(value, summary.minMS), summary.maxMS);
+    };
+    summary.p50MS = percentileMS(50.0);
+    summary.p95MS = percentileMS(95.0);
+    summary.p99MS = percentileMS(99.0);
+}
+
+void AppendSummaryJson(std::string& out, const FFrameTimeSummary& summary) {
+    char buffer[512];
+    std::snprintf(buffer, sizeof(buffer),
+                  "{\"frames\":%llu,\"minMS\":%.3f,\"avgMS\":%.3f,\"p50MS\":%.3f,\"p95MS\":%.3f,"
+                  "\"p99MS\":%.3f,\"maxMS\":%.3f,\"hitches\":%llu}",
+                  static_cast<unsigned long long>(summary.frameCount), summary.minMS, summary.avgMS,
+                  summary.p50MS, summary.p95MS, summary.p99MS, summary.maxMS,
+                  static_cast<unsigned long long>(summary.hitchCount));
+    out += buffer;
+}
+
+} // namespace
+
+FFrameStats::FFrameStats(uint32_t windowFrames)
+    : windowSamples(std::max<uint32_t>(windowFrames, 1), 0)
+    , hitchBudgetMS(DEFAULT_HITCH_BUDGET_MS)
+    , hitchBudgetUS(ToMicroseconds(DEFAULT_HITCH_BUDGET_MS / 1000.0))
+{
+}
+
+void FFrameStats::AddFrame(double frameTimeSeconds) {
+    uint32_t frameTimeUS = ToMicroseconds(frameTimeSeconds);
+    bool bHitch = IsHitch(frameTimeUS);
+
+    // Rolling window: the new frame replaces the oldest once the ring is full
+    if (windowCount == windowSamples.size()) {
+        uint32_t oldest = windowSamples[windowNext];
+        windowHistogram.Remove(oldest);
+        windowSumUS -= oldest;
+        if (IsHitch(oldest)) {
+            windowHitches--;
+        }
+    } else {
+        windowCount++;
+    }
+    windowSamples[windowNext] = frameTimeUS;
+    windowNext = (windowNext + 1) % windowSamples.size();
+    windowHistogram.Add(frameTimeUS);
+    windowSumUS += frameTimeUS;
+    if (bHitch) {
+        windowHitches++;
+    }
+
+    // Session
+    if (sessionHistogram.GetCount() == 0) {
+        sessionMinUS = frameTimeUS;
+        sessionMaxUS = frameTimeUS;
+    } else {
+        sessionMinUS = std::min(sessionMinUS, frameTimeUS);
+        sessionMaxUS = std::max(sessionMaxUS, frameTimeUS);
+    }
+    sessionHistogram.Add(frameTimeUS);
+    sessionSumUS += frameTimeUS;
+    if (bHitch) {
+        sessionHitches++;
+    }
+}
+
+void FFrameStats::Reset() {
+    std::fill(windowSamples.begin(), windowSamples.end(), 0);
+    windowNext = 0;
+    windowCount = 0;
+    windowSumUS = 0;
+    windowHitches = 0;
+    windowHistogram.Reset();
+
+    sessionHistogram.Reset();
+    sessionSumUS = 0;
+    sessionMinUS = 0;
+    sessionMaxUS = 0;
+    sessionHitches = 0;
+}
+
+void FFrameStats::SetHitchBudgetMS(double budgetMS) {
+    hitchBudgetMS = budgetMS;
+    hitchBudgetUS = ToMicroseconds(budgetMS / 1000.0);
+
+    // Earlier session frames keep the budget they were counted against
+    windowHitches = 0;
+    for (size_t i = 0; i < windowCount; i++) {
+        if (IsHitch(windowSamples[i])) {
+            windowHitches++;
+        }
+    }
+}
+
+FFrameTimeSummary FFrameStats::GetWindowSummary() const {
+    FFrameTimeSummary summary;
+    if (windowCount == 0) {
+        return summary;
+    }
+
+    // Exact extremes: the window is small enough to scan
+    uint32_t minUS = std::numeric_limits<uint32_t>::max();
+    uint32_t maxUS = 0;
+    for (size_t i = 0; i < windowCount; i++) {
+        minUS = std::min(minUS, windowSamples[i]);
+        maxUS = std::max(maxUS, windowSamples[i]);
+    }
+
+    summary.frameCount = windowCount;
+    summary.minMS = ToMilliseconds(minUS);
+    summary.maxMS = ToMilliseconds(maxUS);
+    summary.avgMS = ToMilliseconds(windowSumUS) / static_cast<double>(windowCount);
+    summary.hitchCount = windowHitches;
+    FillPercentiles(summary, windowHistogram);
+    return summary;
+}
+
+FFrameTimeSummary FFrameStats::GetSessionSummary() const {
+    FFrameTimeSummary summary;
+    uint64_t frameCount = sessionHistogram.GetCount();
+    if (frameCount == 0) {
+        return summary;
+    }
+
+    summary.frameCount = frameCount;
+    summary.minMS = ToMilliseconds(sessionMinUS);
+    summary.maxMS = ToMilliseconds(sessionMaxUS);
+    summary.avgMS = ToMilliseconds(sessionSumUS) / static_cast<double>(frameCount);
+    summary.hitchCount = sessionHitches;
+    FillPercentiles(summary, sessionHistogram);
+    return summary;
+}
+
+std::string FFrameStats::FormatSummary(const FFrameTimeSummary& summary) {
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "Frame time (ms): min %.2f | avg %.2f | p50 %.2f | p95 %.2f | p99 %.2f | max %.2f | hitches %llu/%llu",
+                  summary.minMS, summary.avgMS, summary.p50MS, summary.p95MS, summary.p99MS, summary.maxMS,
+                  static_cast<unsigned long long>(summary.hitchCount),
+                  static_cast<unsigned long long>(summary.frameCount));
+    return buffer;
+}
+
+std::string FFrameStats::ToJson(const std::string& label) const {
+    std::string json = "{\"label\":\"";
+    for (char c : label) {
+        if (c == '"' || c == '\\') {
+            json += '\\';
+        }
+        json += c;
+    }
+
+    char buffer[128];
+    std::snprintf(buffer, sizeof(buffer), "\",\"hitchBudgetMS\":%.3f,\"windowFrames\":%u,\n\"session\":",
+                  hitchBudgetMS, GetWindowFrames());
+    json += buffer;
+    AppendSummaryJson(json, GetSessionSummary());
+    json += ",\n\"window\":";
+    AppendSummaryJson(json, GetWindowSummary());
+
+    // Non-empty session buckets: [lowerUS, upperUS, count]
+    json += ",\n\"histogramUS\":[";
+    bool bFirstBucket = true;
+    for (uint32_t i = 0; i < FFrameTimeHistogram::BUCKET_COUNT; i++) {
+        uint64_t count = sessionHistogram.GetBucketCount(i);
+        if (count == 0) {
+            continue;
+        }
+        std::snprintf(buffer, sizeof(buffer), "%s[%llu,%llu,%llu]", bFirstBucket ? "" : ",",
+                      static_cast<unsigned long long>(FFrameTimeHistogram::GetBucketLowerBoundUS(i)),
+                      static_cast<unsigned long long>(FFrameTimeHistogram::GetBucketUpperBoundUS(i)),
+                      static_cast<unsigned long long>(count));
+        json += buffer;
+        bFirstBucket = false;
+    }
+    json += "]}\n";
+    return json;
+}
+
+bool FFrameStats::WriteJson(const std::string& filePath, const std::string& label) const {
+    std::string json = ToJson(label);
+    std::ofstream file(filePath, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file.is_open()) {
+        UE_LOG_ERROR(LogCategories::Core, "Could not write frame statistics to %s", filePath.c_str());
+        return false;
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    return true;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Frame time statistics (similar to UE5's stat unit / FPS charts)
+//
+// Frame times go into HDR-style histograms: values are bucketed in microseconds
+// with 32 linear sub-buckets per power of two, so any recorded value is known to
+// within ~3% while the memory stays constant (a few KB) from 1 us up to a minute.
+// FFrameStats keeps one histogram over a rolling window of recent frames and one
+// over the whole session, and counts hitches (frames over a time budget).
+
+// Summary of a set of frame times (all times in milliseconds)
+struct FFrameTimeSummary {
+    uint64_t frameCount = 0;
+    double minMS = 0.0;
+    double avgMS = 0.0;
+    double p50MS = 0.0;
+    double p95MS = 0.0;
+    double p99MS = 0.0;
+    double maxMS = 0.0;
+    uint64_t hitchCount = 0;    // Frames longer than the hitch budget
+};
+
+namespace FrameStatsDetail {
+
+// Linear sub-buckets per power of two (relative error 1/32)
+constexpr uint32_t SUB_BUCKET_BITS = 5;
+
+// Longer frame times are counted in the last bucket
+constexpr uint64_t MAX_TRACKABLE_US = 60ull * 1000 * 1000;
+
+constexpr uint32_t FloorLog2(uint64_t value) {
+    uint32_t result = 0;
+    while (value >>= 1) {
+        result++;
+    }
+    return result;
+}
+
+// Values below 2^SUB_BUCKET_BITS get one bucket each; above that, each power of
+// two is split into 2^SUB_BUCKET_BITS buckets indexed by the top bits of the value
+constexpr uint32_t GetBucketIndex(uint64_t valueUS) {
+    if (valueUS > MAX_TRACKABLE_US) {
+        valueUS = MAX_TRACKABLE_US;
+    }
+    if (valueUS < (1ull << SUB_BUCKET_BITS)) {
+        return static_cast<uint32_t>(valueUS);
+    }
+    uint32_t shift = FloorLog2(valueUS) - SUB_BUCKET_BITS;
+    return static_cast<uint32_t>((static_cast<uint64_t>(shift) << SUB_BUCKET_BITS) + (valueUS >> shift));
+}
+
+} // namespace FrameStatsDetail
+
+class FFrameTimeHistogram {
+public:
+    static constexpr uint64_t MAX_TRACKABLE_US = FrameStatsDetail::MAX_TRACKABLE_US;
+    static constexpr uint32_t BUCKET_COUNT = FrameStatsDetail::GetBucketIndex(MAX_TRACKABLE_US) + 1;
+
+    static uint32_t GetBucketIndex(uint64_t valueUS) { return FrameStatsDetail::GetBucketIndex(valueUS); }
+
+    // Range of values [lower, upper] counted in a bucket
+    static uint64_t GetBucketLowerBoundUS(uint32_t index);
+    static uint64_t GetBucketUpperBoundUS(uint32_t index);
+
+    void Add(uint64_t valueUS);
+    void Remove(uint64_t valueUS);
+    void Reset();
+
+    uint64_t GetCount() const { return totalCount; }
+    uint64_t GetBucketCount(uint32_t index) const { return counts[index]; }
+
+    // Upper bound of the bucket holding the given percentile (0-100), 0 if empty
+    uint64_t GetValueAtPercentileUS(double percentile) const;
+
+private:
+    std::array<uint64_t, BUCKET_COUNT> counts{};
+    uint64_t totalCount = 0;
+};
+
+// Streaming frame time statistics. Not thread-safe: add frames and read the
+// summaries from the thread that ticks the owning FFrameTimer (or after it stopped).
+class FFrameStats {
+public:
+    // Rolling window length (~10 s at 60 FPS)
+    static constexpr uint32_t DEFAULT_WINDOW_FRAMES = 600;
+
+    // Default hitch budget: a frame that missed a whole 60 Hz vblank
+    static constexpr double DEFAULT_HITCH_BUDGET_MS = 33.3;
+
+    explicit FFrameStats(uint32_t windowFrames = DEFAULT_WINDOW_FRAMES);
+
+    void AddFrame(double frameTimeSeconds);
+    void Reset();
+
+    // Frames longer than budgetMS count as hitches (recounts the current window)
+    void SetHitchBudgetMS(double budgetMS);
+    double GetHitchBudgetMS() const { return hitchBudgetMS; }
+
+    uint32_t GetWindowFrames() const { return static_cast<uint32_t>(windowSamples.size()); }
+
+    // Last GetWindowFrames() frames
+    FFrameTimeSummary GetWindowSummary() const;
+
+    // Every frame since construction or Reset
+    FFrameTimeSummary GetSessionSummary() const;
+    const FFrameTimeHistogram& GetSessionHistogram() const { return sessionHistogram; }
+
+    // One-line summary, e.g. for the periodic stats log
+    static std::string FormatSummary(const FFrameTimeSummary& summary);
+
+    // Machine-readable dump (JSON: session and window summaries plus the session histogram)
+    std::string ToJson(const std::string& label) const;
+    bool WriteJson(const std::string& filePath, const std::string& label) const;
+
+private:
+    bool IsHitch(uint32_t frameTimeUS) const { return frameTimeUS > hitchBudgetUS; }
+
+    std::vector<uint32_t> windowSamples;   // Ring of the last frame times (microseconds)
+    size_t windowNext = 0;
+    size_t windowCount = 0;
+    uint64_t windowSumUS = 0;
+    uint64_t windowHitches = 0;
+    FFrameTimeHistogram windowHistogram;
+
+    FFrameTimeHistogram sessionHistogram;
+    uint64_t sessionSumUS = 0;
+    uint32_t sessionMinUS = 0;
+    uint32_t sessionMaxUS = 0;
+    uint64_t sessionHitches = 0;
+
+    double hitchBudgetMS;
+    uint32_t hitchBudgetUS;
+};
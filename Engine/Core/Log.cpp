@@ -1,75 +1,731 @@
 #include "Log.h"
+#include "LogRingBuffer.h"
+#include "Stats.h"
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
 #include <cstdarg>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+DECLARE_DWORD_COUNTER_STAT("Log lines", STAT_LogLines, Core);
 
 // Static member initialization
-ELogVerbosity FLog::MinVerbosity = ELogVerbosity::Display;
+ELogVerbosity FLog::MinVerbosity = ELogVerbosity::Log;
+ELogVerbosity FLog::SyncFlushVerbosity = ELogVerbosity::Error;
+std::atomic<bool> FLog::bAsyncMode{false};
 bool FLog::bConsoleOutput = true;
 bool FLog::bFileOutput = true;
+bool FLog::bBinaryFileOutput = false;
 std::ofstream FLog::LogFile;
 std::mutex FLog::LogMutex;
 
+namespace {
+
+// Per-thread ring size. A full ring makes the producer wait for the writer.
+constexpr size_t LOG_THREAD_BUFFER_SIZE = 64 * 1024;
+
+// Messages up to this size are formatted on the stack with a single vsnprintf
+constexpr size_t LOG_INLINE_MESSAGE_SIZE = 512;
+
+// Longest the writer sleeps before draining the rings
+constexpr auto LOG_WRITER_POLL_INTERVAL = std::chrono::milliseconds(10);
+
+// Maximum length of "[HH:MM:SS.mmm] Category: Verbosity: "
+constexpr size_t LOG_LINE_PREFIX_SIZE = 256;
+
+constexpr const char* FATAL_TERMINATE_MESSAGE = "FATAL ERROR: Application will now terminate.";
+
+struct FLogThreadBuffer {
+    explicit FLogThreadBuffer(uint32_t index) : ring(LOG_THREAD_BUFFER_SIZE), threadIndex(index) {}
+    
+    FLogRingBuffer ring;
+    const uint32_t threadIndex;
+    std::atomic<bool> bThreadExited{false};
+};
+
+// Shared by the logging threads and the writer thread
+struct FAsyncLogState {
+    // Registered thread rings (the writer drops them once their thread exited and they are empty)
+    std::mutex registryMutex;
+    std::vector<std::shared_ptr<FLogThreadBuffer>> threadBuffers;
+    uint32_t nextThreadIndex = 0;
+    
+    std::thread writerThread;
+    std::mutex writerMutex;
+    std::mutex batchMutex;              // Held while consuming the rings (see DrainIfAsyncStopped)
+    std::condition_variable wakeCondition;
+    std::condition_variable flushCondition;
+    std::atomic<bool> bWakePending{false};
+    bool bStopRequested = false;        // Guarded by writerMutex
+    uint64_t flushRequested = 0;        // Guarded by writerMutex
+    uint64_t flushCompleted = 0;        // Guarded by writerMutex
+    
+    ELogFlushPolicy flushPolicy = ELogFlushPolicy::Interval;
+    std::chrono::milliseconds flushInterval{100};
+    
+    // WriteAsyncBatch scratch (guarded by batchMutex), reused between batches
+    struct FPendingLine {
+        int64_t timestamp;
+        uint32_t threadIndex;
+        ELogVerbosity verbosity;
+        ELogRecordType type;
+        const char* category;
+        const char* format;
+        size_t payloadOffset;   // Raw record payload in recordPayloads
+        size_t payloadLength;
+        size_t textOffset;      // Formatted line in lineText (if text output is needed)
+        size_t textLength;
+    };
+    std::vector<FPendingLine> pendingLines;
+    std::string recordPayloads;
+    std::string lineText;
+    std::string stdoutBatch;
+    std::string stderrBatch;
+    std::string fileBatch;
+};
+
+FAsyncLogState& GetAsyncState() {
+    static FAsyncLogState state;
+    return state;
+}
+
+// String table of the binary log file. Guarded by FLog::LogMutex.
+struct FBinaryLogStrings {
+    std::unordered_map<const char*, uint32_t> stringIds;
+    uint32_t nextStringId = 0;
+};
+
+FBinaryLogStrings& GetBinaryLogStrings() {
+    static FBinaryLogStrings strings;
+    return strings;
+}
+
+template<typename T>
+void AppendBinary(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Id of a static string in the binary file, appending its definition the first time
+uint32_t GetBinaryStringId(std::string& out, const char* string) {
+    FBinaryLogStrings& strings = GetBinaryLogStrings();
+    auto found = strings.stringIds.find(string);
+    if (found != strings.stringIds.end()) {
+        return found->second;
+    }
+    
+    uint32_t id = strings.nextStringId++;
+    uint32_t length = static_cast<uint32_t>(std::strlen(string));
+    AppendBinary(out, LogBinaryFile::ELogFileEntry::String);
+    AppendBinary(out, id);
+    AppendBinary(out, length);
+    out.append(string, length);
+    strings.stringIds.emplace(string, id);
+    return id;
+}
+
+void AppendBinaryText(std::string& out, int64_t timestamp, uint32_t threadIndex, ELogVerbosity verbosity,
+                      const char* category, const char* text, size_t length) {
+    uint32_t categoryId = GetBinaryStringId(out, category);
+    AppendBinary(out, LogBinaryFile::ELogFileEntry::Text);
+    AppendBinary(out, timestamp);
+    AppendBinary(out, threadIndex);
+    AppendBinary(out, categoryId);
+    AppendBinary(out, static_cast<uint8_t>(verbosity));
+    AppendBinary(out, static_cast<uint32_t>(length));
+    out.append(text, length);
+}
+
+// Marks the ring as orphaned when its thread exits; the writer still drains it
+struct FLogThreadBufferHolder {
+    std::shared_ptr<FLogThreadBuffer> buffer;
+    
+    ~FLogThreadBufferHolder() {
+        if (buffer) {
+            buffer->bThreadExited.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local FLogThreadBufferHolder ThreadBufferHolder;
+
+FLogThreadBuffer& GetThreadBuffer() {
+    if (!ThreadBufferHolder.buffer) {
+        FAsyncLogState& state = GetAsyncState();
+        std::lock_guard<std::mutex> lock(state.registryMutex);
+        ThreadBufferHolder.buffer = std::make_shared<FLogThreadBuffer>(state.nextThreadIndex++);
+        state.threadBuffers.push_back(ThreadBufferHolder.buffer);
+    }
+    return *ThreadBufferHolder.buffer;
+}
+
+// Reserve space in the calling thread's ring, waiting for the writer if it is full.
+// nullptr if the record can never fit or async mode was switched off meanwhile.
+uint8_t* ReserveRecord(FLogRingBuffer& ring, size_t recordSize);
+
+void WakeWriter() {
+    FAsyncLogState& state = GetAsyncState();
+    // A lost wakeup only costs one poll interval
+    if (!state.bWakePending.exchange(true, std::memory_order_acq_rel)) {
+        state.wakeCondition.notify_one();
+    }
+}
+
+uint8_t* ReserveRecord(FLogRingBuffer& ring, size_t recordSize) {
+    if (recordSize > ring.Capacity() / 2) {
+        return nullptr;
+    }
+    
+    uint8_t* destination = ring.BeginWrite(recordSize);
+    while (destination == nullptr) {
+        // Ring full: let the writer catch up
+        WakeWriter();
+        std::this_thread::yield();
+        if (!FLog::IsAsyncMode()) {
+            return nullptr;
+        }
+        destination = ring.BeginWrite(recordSize);
+    }
+    return destination;
+}
+
+// Wake the writer early when the ring fills up instead of on every record
+void OnRecordCommitted(FLogRingBuffer& ring) {
+    if (ring.UsedBytes() > ring.Capacity() / 2) {
+        WakeWriter();
+    }
+}
+
+// Wall-clock reference for converting monotonic record timestamps
+struct FClockAnchor {
+    std::chrono::steady_clock::time_point steady = std::chrono::steady_clock::now();
+    std::chrono::system_clock::time_point system = std::chrono::system_clock::now();
+};
+
+const FClockAnchor& GetClockAnchor() {
+    static const FClockAnchor anchor;
+    return anchor;
+}
+
+// localtime_r is only called once per second per thread
+const std::tm& GetLocalTime(std::time_t seconds) {
+    thread_local std::time_t cachedSeconds = -1;
+    thread_local std::tm cachedTime{};
+    if (seconds != cachedSeconds) {
+        #ifdef _WIN32
+        localtime_s(&cachedTime, &seconds);
+        #else
+        localtime_r(&seconds, &cachedTime);
+        #endif
+        cachedSeconds = seconds;
+    }
+    return cachedTime;
+}
+
+// Registered log categories and settings for names that did not register yet.
+// Function-local so categories can register during static initialization.
+struct FLogCategoryRegistry {
+    std::mutex mutex;
+    std::vector<FLogCategory*> categories;
+    std::unordered_map<std::string, ELogVerbosity> pendingVerbosities;
+    
+    // Append-only copy of the first categories for lookups by name without the mutex
+    // (FLog::IsCategoryActive). Categories are static objects and never unregister.
+    static constexpr size_t MAX_LOOKUP_CATEGORIES = 256;
+    std::atomic<FLogCategory*> lookupCategories[MAX_LOOKUP_CATEGORIES] = {};
+    std::atomic<size_t> lookupCount{0};
+};
+
+FLogCategoryRegistry& GetCategoryRegistry() {
+    static FLogCategoryRegistry registry;
+    return registry;
+}
+
+// "LogRender", "logrender" and "Render" all name the same category
+std::string NormalizeCategoryName(const std::string& name) {
+    std::string normalized;
+    normalized.reserve(name.size());
+    for (char c : name) {
+        normalized += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (normalized.size() > 3 && normalized.compare(0, 3, "log") == 0) {
+        normalized.erase(0, 3);
+    }
+    return normalized;
+}
+
+// Fatal is never filtered at runtime
+uint8_t ClampRuntimeVerbosity(ELogVerbosity verbosity) {
+    return static_cast<uint8_t>(std::max(verbosity, ELogVerbosity::Fatal));
+}
+
+std::string TrimWhitespace(const std::string& text) {
+    size_t begin = 0;
+    size_t end = text.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(text[begin]))) {
+        begin++;
+    }
+    while (end > begin && std::isspace(static_cast<unsigned char>(text[end - 1]))) {
+        end--;
+    }
+    return text.substr(begin, end - begin);
+}
+
+} // namespace
+
+FLogCategory::FLogCategory(const char* categoryName)
+    : name(categoryName)
+    , verbosity(ClampRuntimeVerbosity(ELogVerbosity::Log))
+{
+    FLog::RegisterCategory(*this);
+}
+
+void FLog::RegisterCategory(FLogCategory& category) {
+    FLogCategoryRegistry& registry = GetCategoryRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    
+    auto pending = registry.pendingVerbosities.find(NormalizeCategoryName(category.name));
+    if (pending != registry.pendingVerbosities.end()) {
+        category.verbosity.store(ClampRuntimeVerbosity(pending->second), std::memory_order_relaxed);
+        category.bOverridden = true;
+    } else {
+        category.verbosity.store(ClampRuntimeVerbosity(MinVerbosity), std::memory_order_relaxed);
+    }
+    registry.categories.push_back(&category);
+    
+    size_t lookupCount = registry.lookupCount.load(std::memory_order_relaxed);
+    if (lookupCount < FLogCategoryRegistry::MAX_LOOKUP_CATEGORIES) {
+        registry.lookupCategories[lookupCount].store(&category, std::memory_order_relaxed);
+        registry.lookupCount.store(lookupCount + 1, std::memory_order_release);
+    }
+}
+
+void FLog::SetVerbosity(ELogVerbosity verbosity) {
+    FLogCategoryRegistry& registry = GetCategoryRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    
+    MinVerbosity = verbosity;
+    for (FLogCategory* category : registry.categories) {
+        if (!category->bOverridden) {
+            category->verbosity.store(ClampRuntimeVerbosity(verbosity), std::memory_order_relaxed);
+        }
+    }
+}
+
+void FLog::SetCategoryVerbosity(const std::string& categoryName, ELogVerbosity verbosity) {
+    FLogCategoryRegistry& registry = GetCategoryRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    
+    std::string normalized = NormalizeCategoryName(categoryName);
+    registry.pendingVerbosities[normalized] = verbosity;
+    for (FLogCategory* category : registry.categories) {
+        if (NormalizeCategoryName(category->name) == normalized) {
+            category->verbosity.store(ClampRuntimeVerbosity(verbosity), std::memory_order_relaxed);
+            category->bOverridden = true;
+        }
+    }
+}
+
+void FLog::ResetCategoryVerbosities() {
+    FLogCategoryRegistry& registry = GetCategoryRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    
+    registry.pendingVerbosities.clear();
+    for (FLogCategory* category : registry.categories) {
+        category->verbosity.store(ClampRuntimeVerbosity(MinVerbosity), std::memory_order_relaxed);
+        category->bOverridden = false;
+    }
+}
+
+bool FLog::IsCategoryActive(const char* categoryName, ELogVerbosity verbosity) {
+    if (verbosity == ELogVerbosity::Fatal) {
+        return true;
+    }
+    
+    // No lock: the helpers are normally called with the name literal of the category
+    // itself, so a pointer comparison finds it; other strings fall back to strcmp
+    FLogCategoryRegistry& registry = GetCategoryRegistry();
+    size_t lookupCount = registry.lookupCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < lookupCount; i++) {
+        const FLogCategory* category = registry.lookupCategories[i].load(std::memory_order_relaxed);
+        if (category->name == categoryName) {
+            return category->IsActive(verbosity);
+        }
+    }
+    for (size_t i = 0; i < lookupCount; i++) {
+        const FLogCategory* category = registry.lookupCategories[i].load(std::memory_order_relaxed);
+        if (std::strcmp(category->name, categoryName) == 0) {
+            return category->IsActive(verbosity);
+        }
+    }
+    
+    if (lookupCount == FLogCategoryRegistry::MAX_LOOKUP_CATEGORIES) {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (size_t i = lookupCount; i < registry.categories.size(); i++) {
+            if (std::strcmp(registry.categories[i]->name, categoryName) == 0) {
+                return registry.categories[i]->IsActive(verbosity);
+            }
+        }
+    }
+    return verbosity <= MinVerbosity;
+}
+
+bool FLog::ParseVerbosity(const std::string& text, ELogVerbosity& outVerbosity) {
+    static const struct {
+        const char* name;
+        ELogVerbosity verbosity;
+    } VERBOSITY_NAMES[] = {
+        { "nologging", ELogVerbosity::NoLogging },
+        { "off", ELogVerbosity::NoLogging },
+        { "fatal", ELogVerbosity::Fatal },
+        { "error", ELogVerbosity::Error },
+        { "warning", ELogVerbosity::Warning },
+        { "display", ELogVerbosity::Display },
+        { "log", ELogVerbosity::Log },
+        { "info", ELogVerbosity::Log },
+        { "verbose", ELogVerbosity::Verbose },
+        { "veryverbose", ELogVerbosity::VeryVerbose },
+        { "all", ELogVerbosity::VeryVerbose }
+    };
+    
+    std::string lowered;
+    for (char c : text) {
+        lowered += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    for (const auto& entry : VERBOSITY_NAMES) {
+        if (lowered == entry.name) {
+            outVerbosity = entry.verbosity;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FLog::ApplyLogCommands(const std::string& commands, std::string* outError) {
+    size_t position = 0;
+    while (position <= commands.size()) {
+        size_t separator = commands.find(',', position);
+        if (separator == std::string::npos) {
+            separator = commands.size();
+        }
+        std::string entry = TrimWhitespace(commands.substr(position, separator - position));
+        position = separator + 1;
+        if (entry.empty()) {
+            continue;
+        }
+        
+        if (NormalizeCategoryName(entry) == "reset") {
+            ResetCategoryVerbosities();
+            continue;
+        }
+        
+        // "Category Verbosity" or "Category=Verbosity"
+        size_t split = entry.find_first_of(" \t=");
+        std::string categoryName = entry.substr(0, split);
+        std::string verbosityName = split != std::string::npos ? TrimWhitespace(entry.substr(split + 1)) : "";
+        if (!verbosityName.empty() && verbosityName[0] == '=') {
+            verbosityName = TrimWhitespace(verbosityName.substr(1));
+        }
+        
+        ELogVerbosity verbosity;
+        if (!ParseVerbosity(verbosityName, verbosity)) {
+            if (outError != nullptr) {
+                *outError = "Invalid log command '" + entry + "' (expected '<Category> <Verbosity>')";
+            }
+            return false;
+        }
+        
+        if (NormalizeCategoryName(categoryName) == "global") {
+            SetVerbosity(verbosity);
+        } else {
+            SetCategoryVerbosity(categoryName, verbosity);
+        }
+    }
+    return true;
+}
+
+void FLog::ParseCommandLine(int argc, char* argv[]) {
+    static const char LOG_COMMANDS_OPTION[] = "-LogCmds=";
+    const size_t optionLength = sizeof(LOG_COMMANDS_OPTION) - 1;
+    
+    for (int i = 1; i < argc; i++) {
+        if (argv[i] == nullptr || std::strncmp(argv[i], LOG_COMMANDS_OPTION, optionLength) != 0) {
+            continue;
+        }
+        
+        std::string commands = argv[i] + optionLength;
+        if (commands.size() >= 2 && commands.front() == '"' && commands.back() == '"') {
+            commands = commands.substr(1, commands.size() - 2);
+        }
+        
+        std::string error;
+        if (!ApplyLogCommands(commands, &error)) {
+            std::cerr << "Warning: " << error << std::endl;
+        }
+    }
+}
+
+std::string FLog::DescribeCategories() {
+    FLogCategoryRegistry& registry = GetCategoryRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    
+    std::string description = std::string("global: ") + GetVerbosityString(MinVerbosity) + "\n";
+    for (const FLogCategory* category : registry.categories) {
+        description += category->name;
+        description += ": ";
+        description += GetVerbosityString(category->GetVerbosity());
+        if (category->bOverridden) {
+            description += " (set)";
+        }
+        description += "\n";
+    }
+    return description;
+}
+
 void FLog::Initialize(const std::string& logFile) {
+    GetClockAnchor();
+    
     if (bFileOutput) {
-        LogFile.open(logFile, std::ios::out | std::ios::trunc);
+        std::lock_guard<std::mutex> lock(LogMutex);
+        std::ios::openmode mode = std::ios::out | std::ios::trunc;
+        if (bBinaryFileOutput) {
+            mode |= std::ios::binary;
+        }
+        LogFile.open(logFile, mode);
         if (!LogFile.is_open()) {
             std::cerr << "Warning: Could not open log file: " << logFile << std::endl;
             bFileOutput = false;
+        } else if (bBinaryFileOutput) {
+            const FClockAnchor& anchor = GetClockAnchor();
+            LogBinaryFile::FFileHeader header{};
+            std::memcpy(header.magic, LogBinaryFile::MAGIC, sizeof(header.magic));
+            header.version = LogBinaryFile::VERSION;
+            header.steadyAnchor = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                anchor.steady.time_since_epoch()).count();
+            header.systemAnchor = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                anchor.system.time_since_epoch()).count();
+            LogFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            GetBinaryLogStrings() = FBinaryLogStrings();
         }
     }
     
-    FLog::Info(LogCategories::Core::GetLogCategory(), "=== Engine Log Started ===");
+    FLog::Info(LogCategories::Core::Instance, "=== Engine Log Started ===");
 }
 
 void FLog::Shutdown() {
-    FLog::Info(LogCategories::Core::GetLogCategory(), "=== Engine Log Ended ===");
+    FLog::Info(LogCategories::Core::Instance, "=== Engine Log Ended ===");
+    
+    SetAsyncMode(false);
     
+    std::lock_guard<std::mutex> lock(LogMutex);
     if (LogFile.is_open()) {
         LogFile.close();
     }
 }
 
+void FLog::SetAsyncMode(bool enabled) {
+    FAsyncLogState& state = GetAsyncState();
+    
+    if (enabled) {
+        if (bAsyncMode.load(std::memory_order_acquire)) {
+            return;
+        }
+        GetClockAnchor();
+        {
+            std::lock_guard<std::mutex> lock(state.writerMutex);
+            state.bStopRequested = false;
+        }
+        state.writerThread = std::thread(&FLog::AsyncWriterMain);
+        bAsyncMode.store(true, std::memory_order_release);
+        return;
+    }
+    
+    // seq_cst: pairs with the fence in DrainIfAsyncStopped
+    if (!bAsyncMode.exchange(false)) {
+        return;
+    }
+    
+    // The writer drains every ring once more before exiting. Records committed after
+    // that drain are written by their own producer (DrainIfAsyncStopped).
+    {
+        std::lock_guard<std::mutex> lock(state.writerMutex);
+        state.bStopRequested = true;
+    }
+    state.wakeCondition.notify_one();
+    if (state.writerThread.joinable()) {
+        state.writerThread.join();
+    }
+}
+
+void FLog::DrainIfAsyncStopped() {
+    // A producer that saw async mode on can commit after the writer's final drain.
+    // Either it sees the mode switched off here, or the exchange in SetAsyncMode came
+    // after this load and the writer's final drain sees the record.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (bAsyncMode.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    FAsyncLogState& state = GetAsyncState();
+    std::lock_guard<std::mutex> lock(state.batchMutex);
+    WriteAsyncBatch(true);
+}
+
+void FLog::SetFlushPolicy(ELogFlushPolicy policy, uint32_t intervalMs) {
+    FAsyncLogState& state = GetAsyncState();
+    std::lock_guard<std::mutex> lock(state.writerMutex);
+    state.flushPolicy = policy;
+    state.flushInterval = std::chrono::milliseconds(intervalMs);
+}
+
+void FLog::Flush() {
+    FAsyncLogState& state = GetAsyncState();
+    
+    if (bAsyncMode.load(std::memory_order_acquire)) {
+        std::unique_lock<std::mutex> lock(state.writerMutex);
+        if (!state.bStopRequested) {
+            uint64_t ticket = ++state.flushRequested;
+            state.bWakePending.store(true, std::memory_order_relaxed);
+            state.wakeCondition.notify_one();
+            state.flushCondition.wait(lock, [&state, ticket] {
+                return state.flushCompleted >= ticket;
+            });
+            return;
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(LogMutex);
+    if (bConsoleOutput) {
+        std::cout.flush();
+        std::cerr.flush();
+    }
+    if (LogFile.is_open()) {
+        LogFile.flush();
+    }
+}
+
+int64_t FLog::GetTimestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 void FLog::Log(ELogVerbosity verbosity, const char* category, const char* format, ...) {
-    if (verbosity <= MinVerbosity) {
-        va_list args;
-        va_start(args, format);
+    va_list args;
+    va_start(args, format);
+    LogChecked(verbosity, IsCategoryActive(category, verbosity), category, format, args);
+    va_end(args);
+}
+
+void FLog::Log(ELogVerbosity verbosity, const FLogCategory& category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    LogChecked(verbosity, category.IsActive(verbosity), category.GetName(), format, args);
+    va_end(args);
+}
+
+void FLog::LogChecked(ELogVerbosity verbosity, bool bCategoryActive, const char* category,
+                      const char* format, va_list args) {
+    if (FLogFlightRecorder::IsCapturing(verbosity)) {
+        char message[LOG_INLINE_MESSAGE_SIZE];
+        va_list recorderArgs;
+        va_copy(recorderArgs, args);
+        int length = std::vsnprintf(message, sizeof(message), format, recorderArgs);
+        va_end(recorderArgs);
+        if (length > 0) {
+            FLogFlightRecorder::RecordText(verbosity, category, message,
+                                           std::min(static_cast<size_t>(length), sizeof(message) - 1));
+        }
+    }
+    
+    if (bCategoryActive) {
         InternalLog(verbosity, category, format, args);
-        va_end(args);
     }
 }
 
-void FLog::InternalLog(ELogVerbosity verbosity, const char* category, const char* format, va_list args) {
-    std::lock_guard<std::mutex> lock(LogMutex);
+void FLog::LogUnchecked(ELogVerbosity verbosity, const char* category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    InternalLog(verbosity, category, format, args);
+    va_end(args);
+}
+
+uint8_t* FLog::BeginDeferredRecord(size_t argsSize, ELogVerbosity verbosity,
+                                   const char* category, const char* format) {
+    int64_t timestamp = GetTimestamp();
+    FLogThreadBuffer& threadBuffer = GetThreadBuffer();
+    size_t recordSize = FLogRingBuffer::AlignRecordSize(sizeof(FLogRecordHeader) + argsSize);
+    uint8_t* destination = ReserveRecord(threadBuffer.ring, recordSize);
+    if (destination == nullptr) {
+        return nullptr;
+    }
     
-    std::string message = FormatString(format, args);
+    FLogRecordHeader* header = reinterpret_cast<FLogRecordHeader*>(destination);
+    header->size = static_cast<uint32_t>(recordSize);
+    header->type = ELogRecordType::Deferred;
+    header->verbosity = static_cast<uint8_t>(verbosity);
+    header->reserved = 0;
+    header->payloadLength = static_cast<uint32_t>(argsSize);
+    header->threadIndex = threadBuffer.threadIndex;
+    header->timestamp = timestamp;
+    header->category = category;
+    header->format = format;
+    return reinterpret_cast<uint8_t*>(header + 1);
+}
+
+void FLog::CommitDeferredRecord(size_t argsSize, ELogVerbosity verbosity) {
+    FLogRingBuffer& ring = GetThreadBuffer().ring;
+    ring.CommitWrite(FLogRingBuffer::AlignRecordSize(sizeof(FLogRecordHeader) + argsSize));
+    OnRecordCommitted(ring);
+    DrainIfAsyncStopped();
     
-    // Get current time
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
+    if (verbosity <= SyncFlushVerbosity) {
+        Flush();
+    }
+    if (verbosity == ELogVerbosity::Fatal) {
+        TerminateAfterFatal();
+    }
+}
+
+void FLog::InternalLog(ELogVerbosity verbosity, const char* category, const char* format, va_list args) {
+    if (bAsyncMode.load(std::memory_order_acquire)) {
+        if (EnqueueAsync(verbosity, category, format, args)) {
+            if (verbosity <= SyncFlushVerbosity) {
+                Flush();
+            }
+            if (verbosity == ELogVerbosity::Fatal) {
+                TerminateAfterFatal();
+            }
+            return;
+        }
     
-    std::tm timeInfo;
-    #ifdef _WIN32
-    localtime_s(&timeInfo, &time_t);
-    #else
-    localtime_r(&time_t, &timeInfo);
-    #endif
+        // Too large for the ring or the writer is stopping: keep ordering by writing
+        // everything already queued before this line
+        Flush();
+    }
     
-    // Format timestamp: [HH:MM:SS.mmm]
-    char timeBuffer[64];
-    std::snprintf(timeBuffer, sizeof(timeBuffer), "[%02d:%02d:%02d.%03lld]",
-                  timeInfo.tm_hour, timeInfo.tm_min, timeInfo.tm_sec,
-                  static_cast<long long>(ms.count()));
+    WriteSync(verbosity, category, format, args);
+}
+
+void FLog::WriteSync(ELogVerbosity verbosity, const char* category, const char* format, va_list args) {
+    std::lock_guard<std::mutex> lock(LogMutex);
+    INC_DWORD_STAT(STAT_LogLines);
+    
+    std::string message = FormatString(format, args);
     
     // Format log line: [Timestamp] Category: Verbosity: Message
-    std::stringstream logLine;
-    logLine << timeBuffer << " ";
-    logLine << category << ": ";
-    logLine << GetVerbosityString(verbosity) << ": ";
-    logLine << message;
+    int64_t timestamp = GetTimestamp();
+    char prefix[LOG_LINE_PREFIX_SIZE];
+    size_t prefixLength = FormatLinePrefix(prefix, sizeof(prefix), timestamp, verbosity, category);
     
-    std::string finalMessage = logLine.str();
+    std::string finalMessage;
+    finalMessage.reserve(prefixLength + message.size());
+    finalMessage.append(prefix, prefixLength);
+    finalMessage.append(message);
     
     // Console output with colors
     if (bConsoleOutput) {
@@ -79,20 +735,272 @@ void FLog::InternalLog(ELogVerbosity verbosity, const char* category, const char
     
     // File output (no colors)
     if (bFileOutput && LogFile.is_open()) {
-        LogFile << finalMessage << std::endl;
+        if (bBinaryFileOutput) {
+            WriteFileLine(timestamp, verbosity, category, message.data(), message.size());
+        } else {
+            LogFile << finalMessage << std::endl;
+        }
         LogFile.flush();
     }
     
     // Fatal logs should crash
     if (verbosity == ELogVerbosity::Fatal) {
         if (bFileOutput && LogFile.is_open()) {
-            LogFile << "FATAL ERROR: Application will now terminate." << std::endl;
+            WriteFileLine(GetTimestamp(), verbosity, category, FATAL_TERMINATE_MESSAGE,
+                          std::strlen(FATAL_TERMINATE_MESSAGE));
             LogFile.flush();
         }
         std::abort();
     }
 }
 
+void FLog::WriteFileLine(int64_t timestamp, ELogVerbosity verbosity, const char* category,
+                         const char* text, size_t length) {
+    // Caller holds LogMutex
+    if (bBinaryFileOutput) {
+        std::string entry;
+        AppendBinaryText(entry, timestamp, 0, verbosity, category, text, length);
+        LogFile.write(entry.data(), static_cast<std::streamsize>(entry.size()));
+    } else {
+        LogFile.write(text, static_cast<std::streamsize>(length));
+        LogFile.put('\n');
+    }
+}
+
+bool FLog::EnqueueAsync(ELogVerbosity verbosity, const char* category, const char* format, va_list args) {
+    int64_t timestamp = GetTimestamp();
+    
+    // Single vsnprintf for the common case; longer messages take the two-pass path
+    char inlineMessage[LOG_INLINE_MESSAGE_SIZE];
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int formattedLength = std::vsnprintf(inlineMessage, sizeof(inlineMessage), format, argsCopy);
+    va_end(argsCopy);
+    
+    const char* message = inlineMessage;
+    size_t messageLength = 0;
+    std::string longMessage;
+    if (formattedLength < 0) {
+        message = format;
+        messageLength = std::strlen(format);
+    } else if (static_cast<size_t>(formattedLength) >= sizeof(inlineMessage)) {
+        longMessage = FormatString(format, args);
+        message = longMessage.data();
+        messageLength = longMessage.size();
+    } else {
+        messageLength = static_cast<size_t>(formattedLength);
+    }
+    
+    FLogThreadBuffer& threadBuffer = GetThreadBuffer();
+    FLogRingBuffer& ring = threadBuffer.ring;
+    size_t recordSize = FLogRingBuffer::AlignRecordSize(sizeof(FLogRecordHeader) + messageLength);
+    uint8_t* destination = ReserveRecord(ring, recordSize);
+    if (destination == nullptr) {
+        return false;
+    }
+    
+    FLogRecordHeader* header = reinterpret_cast<FLogRecordHeader*>(destination);
+    header->size = static_cast<uint32_t>(recordSize);
+    header->type = ELogRecordType::Text;
+    header->verbosity = static_cast<uint8_t>(verbosity);
+    header->reserved = 0;
+    header->payloadLength = static_cast<uint32_t>(messageLength);
+    header->threadIndex = threadBuffer.threadIndex;
+    header->timestamp = timestamp;
+    header->category = category;
+    header->format = nullptr;
+    std::memcpy(header + 1, message, messageLength);
+    ring.CommitWrite(recordSize);
+    OnRecordCommitted(ring);
+    DrainIfAsyncStopped();
+    return true;
+}
+
+void FLog::AsyncWriterMain() {
+    FAsyncLogState& state = GetAsyncState();
+    auto lastFlushTime = std::chrono::steady_clock::now();
+    
+    for (;;) {
+        uint64_t flushTicket = 0;
+        bool bFlushRequested = false;
+        bool bStop = false;
+        bool bFlushEveryBatch = false;
+        std::chrono::milliseconds flushInterval{0};
+        {
+            std::unique_lock<std::mutex> lock(state.writerMutex);
+            state.wakeCondition.wait_for(lock, LOG_WRITER_POLL_INTERVAL, [&state] {
+                return state.bStopRequested || state.bWakePending.load(std::memory_order_relaxed) ||
+                       state.flushRequested > state.flushCompleted;
+            });
+            state.bWakePending.store(false, std::memory_order_relaxed);
+            bStop = state.bStopRequested;
+            flushTicket = state.flushRequested;
+            bFlushRequested = flushTicket > state.flushCompleted;
+            bFlushEveryBatch = state.flushPolicy == ELogFlushPolicy::EveryBatch;
+            flushInterval = state.flushInterval;
+        }
+    
+        auto now = std::chrono::steady_clock::now();
+        bool bFlush = bStop || bFlushRequested || bFlushEveryBatch || now - lastFlushTime >= flushInterval;
+        {
+            std::lock_guard<std::mutex> lock(state.batchMutex);
+            WriteAsyncBatch(bFlush);
+        }
+        if (bFlush) {
+            lastFlushTime = now;
+        }
+    
+        {
+            std::lock_guard<std::mutex> lock(state.writerMutex);
+            state.flushCompleted = flushTicket;
+        }
+        state.flushCondition.notify_all();
+    
+        if (bStop) {
+            break;
+        }
+    }
+}
+
+void FLog::WriteAsyncBatch(bool bFlush) {
+    FAsyncLogState& state = GetAsyncState();
+    state.pendingLines.clear();
+    state.recordPayloads.clear();
+    state.lineText.clear();
+    
+    // Copy every published record out of the rings (formatting happens below, off the callers)
+    {
+        std::lock_guard<std::mutex> lock(state.registryMutex);
+        for (auto& threadBuffer : state.threadBuffers) {
+            threadBuffer->ring.Consume([&state](const FLogRecordHeader& header, const char* payload) {
+                size_t payloadOffset = state.recordPayloads.size();
+                state.recordPayloads.append(payload, header.payloadLength);
+                state.pendingLines.push_back({header.timestamp, header.threadIndex,
+                                              static_cast<ELogVerbosity>(header.verbosity), header.type,
+                                              header.category, header.format,
+                                              payloadOffset, header.payloadLength, 0, 0});
+            });
+        }
+        
+        state.threadBuffers.erase(
+            std::remove_if(state.threadBuffers.begin(), state.threadBuffers.end(),
+                           [](const std::shared_ptr<FLogThreadBuffer>& threadBuffer) {
+                               return threadBuffer->bThreadExited.load(std::memory_order_acquire) &&
+                                      threadBuffer->ring.IsEmpty();
+                           }),
+            state.threadBuffers.end());
+    }
+    
+    if (state.pendingLines.empty() && !bFlush) {
+        return;
+    }
+    INC_DWORD_STAT_BY(STAT_LogLines, state.pendingLines.size());
+    
+    // Interleave threads by capture time (each thread's records are already in order)
+    std::stable_sort(state.pendingLines.begin(), state.pendingLines.end(),
+                     [](const FAsyncLogState::FPendingLine& a, const FAsyncLogState::FPendingLine& b) {
+                         return a.timestamp < b.timestamp;
+                     });
+    
+    // Expand deferred records only if some output needs text
+    const bool bTextFile = bFileOutput && !bBinaryFileOutput;
+    if (bConsoleOutput || bTextFile) {
+        for (auto& line : state.pendingLines) {
+            char prefix[LOG_LINE_PREFIX_SIZE];
+            size_t prefixLength = FormatLinePrefix(prefix, sizeof(prefix), line.timestamp,
+                                                   line.verbosity, line.category);
+            
+            line.textOffset = state.lineText.size();
+            state.lineText.append(prefix, prefixLength);
+            const char* payload = state.recordPayloads.data() + line.payloadOffset;
+            if (line.type == ELogRecordType::Deferred) {
+                LogArgs::FormatDeferred(state.lineText, line.format,
+                                        reinterpret_cast<const uint8_t*>(payload), line.payloadLength);
+            } else {
+                state.lineText.append(payload, line.payloadLength);
+            }
+            line.textLength = state.lineText.size() - line.textOffset;
+        }
+    }
+    
+    state.stdoutBatch.clear();
+    state.stderrBatch.clear();
+    state.fileBatch.clear();
+    for (const auto& line : state.pendingLines) {
+        const char* text = state.lineText.data() + line.textOffset;
+        if (bConsoleOutput) {
+            std::string& consoleBatch = (line.verbosity <= ELogVerbosity::Warning) ? state.stderrBatch : state.stdoutBatch;
+            consoleBatch.append(GetVerbosityColor(line.verbosity));
+            consoleBatch.append(text, line.textLength);
+            consoleBatch.append(LogColors::Reset);
+            consoleBatch.push_back('\n');
+        }
+        if (bTextFile) {
+            state.fileBatch.append(text, line.textLength);
+            state.fileBatch.push_back('\n');
+        }
+    }
+    
+    // One buffered write per stream for the whole batch
+    std::lock_guard<std::mutex> lock(LogMutex);
+    if (bFileOutput && bBinaryFileOutput) {
+        // The string table is shared with WriteSync: build the entries under LogMutex
+        for (const auto& line : state.pendingLines) {
+            const char* payload = state.recordPayloads.data() + line.payloadOffset;
+            if (line.type == ELogRecordType::Deferred) {
+                uint32_t categoryId = GetBinaryStringId(state.fileBatch, line.category);
+                uint32_t formatId = GetBinaryStringId(state.fileBatch, line.format);
+                AppendBinary(state.fileBatch, LogBinaryFile::ELogFileEntry::Deferred);
+                AppendBinary(state.fileBatch, line.timestamp);
+                AppendBinary(state.fileBatch, line.threadIndex);
+                AppendBinary(state.fileBatch, categoryId);
+                AppendBinary(state.fileBatch, formatId);
+                AppendBinary(state.fileBatch, static_cast<uint8_t>(line.verbosity));
+                AppendBinary(state.fileBatch, static_cast<uint32_t>(line.payloadLength));
+                state.fileBatch.append(payload, line.payloadLength);
+            } else {
+                AppendBinaryText(state.fileBatch, line.timestamp, line.threadIndex, line.verbosity,
+                                 line.category, payload, line.payloadLength);
+            }
+        }
+    }
+    
+    if (!state.stdoutBatch.empty()) {
+        std::cout.write(state.stdoutBatch.data(), static_cast<std::streamsize>(state.stdoutBatch.size()));
+    }
+    if (!state.stderrBatch.empty()) {
+        std::cerr.write(state.stderrBatch.data(), static_cast<std::streamsize>(state.stderrBatch.size()));
+    }
+    if (!state.fileBatch.empty() && LogFile.is_open()) {
+        LogFile.write(state.fileBatch.data(), static_cast<std::streamsize>(state.fileBatch.size()));
+    }
+    
+    if (bFlush) {
+        std::cout.flush();
+        std::cerr.flush();
+        if (LogFile.is_open()) {
+            LogFile.flush();
+        }
+    }
+}
+
+void FLog::TerminateAfterFatal() {
+    {
+        std::lock_guard<std::mutex> lock(LogMutex);
+        if (bFileOutput && LogFile.is_open()) {
+            WriteFileLine(GetTimestamp(), ELogVerbosity::Fatal, LogCategories::Core::GetLogCategory(),
+                          FATAL_TERMINATE_MESSAGE, std::strlen(FATAL_TERMINATE_MESSAGE));
+            LogFile.flush();
+        }
+    }
+    
+    if (FLogFlightRecorder::Dump()) {
+        std::cerr << "Flight recorder written to " << FLogFlightRecorder::GetDumpFile()
+                  << " (decode with logdecode)" << std::endl;
+    }
+    std::abort();
+}
+
 std::string FLog::FormatString(const char* format, va_list args) {
     // Calculate required buffer size
     va_list argsCopy;
@@ -112,6 +1020,28 @@ std::string FLog::FormatString(const char* format, va_list args) {
     return buffer;
 }
 
+size_t FLog::FormatLinePrefix(char* out, size_t outSize, int64_t timestamp,
+                              ELogVerbosity verbosity, const char* category) {
+    // Monotonic timestamp -> wall clock
+    const FClockAnchor& anchor = GetClockAnchor();
+    auto steadyTime = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timestamp));
+    auto now = anchor.system + std::chrono::duration_cast<std::chrono::system_clock::duration>(steadyTime - anchor.steady);
+    auto time_t = std::chrono::system_clock::to_time_t(now);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now.time_since_epoch()) % 1000;
+    
+    const std::tm& timeInfo = GetLocalTime(time_t);
+    
+    // Format prefix: [HH:MM:SS.mmm] Category: Verbosity:
+    int length = std::snprintf(out, outSize, "[%02d:%02d:%02d.%03lld] %s: %s: ",
+                               timeInfo.tm_hour, timeInfo.tm_min, timeInfo.tm_sec,
+                               static_cast<long long>(ms.count()), category, GetVerbosityString(verbosity));
+    if (length < 0) {
+        return 0;
+    }
+    return std::min(static_cast<size_t>(length), outSize - 1);
+}
+
 const char* FLog::GetVerbosityString(ELogVerbosity verbosity) {
     switch (verbosity) {
         case ELogVerbosity::Fatal: return "Fatal";
@@ -142,42 +1072,341 @@ const char* FLog::GetVerbosityColor(ELogVerbosity verbosity) {
 void FLog::Fatal(const char* category, const char* format, ...) {
     va_list args;
     va_start(args, format);
-    InternalLog(ELogVerbosity::Fatal, category, format, args);
+    LogChecked(ELogVerbosity::Fatal, IsCategoryActive(category, ELogVerbosity::Fatal), category, format, args);
+    va_end(args);
+}
+
+void FLog::Fatal(const FLogCategory& category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    LogChecked(ELogVerbosity::Fatal, category.IsActive(ELogVerbosity::Fatal), category.GetName(), format, args);
     va_end(args);
 }
 
 void FLog::Error(const char* category, const char* format, ...) {
     va_list args;
     va_start(args, format);
-    InternalLog(ELogVerbosity::Error, category, format, args);
+    LogChecked(ELogVerbosity::Error, IsCategoryActive(category, ELogVerbosity::Error), category, format, args);
+    va_end(args);
+}
+
+void FLog::Error(const FLogCategory& category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    LogChecked(ELogVerbosity::Error, category.IsActive(ELogVerbosity::Error), category.GetName(), format, args);
     va_end(args);
 }
 
 void FLog::Warning(const char* category, const char* format, ...) {
     va_list args;
     va_start(args, format);
-    InternalLog(ELogVerbosity::Warning, category, format, args);
+    LogChecked(ELogVerbosity::Warning, IsCategoryActive(category, ELogVerbosity::Warning), category, format, args);
+    va_end(args);
+}
+
+void FLog::Warning(const FLogCategory& category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    LogChecked(ELogVerbosity::Warning, category.IsActive(ELogVerbosity::Warning), category.GetName(), format, args);
     va_end(args);
 }
 
 void FLog::Display(const char* category, const char* format, ...) {
     va_list args;
     va_start(args, format);
-    InternalLog(ELogVerbosity::Display, category, format, args);
+    LogChecked(ELogVerbosity::Display, IsCategoryActive(category, ELogVerbosity::Display), category, format, args);
+    va_end(args);
+}
+
+void FLog::Display(const FLogCategory& category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    LogChecked(ELogVerbosity::Display, category.IsActive(ELogVerbosity::Display), category.GetName(), format, args);
     va_end(args);
 }
 
 void FLog::Info(const char* category, const char* format, ...) {
     va_list args;
     va_start(args, format);
-    InternalLog(ELogVerbosity::Log, category, format, args);
+    LogChecked(ELogVerbosity::Log, IsCategoryActive(category, ELogVerbosity::Log), category, format, args);
+    va_end(args);
+}
+
+void FLog::Info(const FLogCategory& category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    LogChecked(ELogVerbosity::Log, category.IsActive(ELogVerbosity::Log), category.GetName(), format, args);
     va_end(args);
 }
 
 void FLog::Verbose(const char* category, const char* format, ...) {
     va_list args;
     va_start(args, format);
-    InternalLog(ELogVerbosity::Verbose, category, format, args);
+    LogChecked(ELogVerbosity::Verbose, IsCategoryActive(category, ELogVerbosity::Verbose), category, format, args);
+    va_end(args);
+}
+
+void FLog::Verbose(const FLogCategory& category, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    LogChecked(ELogVerbosity::Verbose, category.IsActive(ELogVerbosity::Verbose), category.GetName(), format, args);
     va_end(args);
 }
 
+// ============================================================================
+// Deferred formatting (LogArgs.h)
+// ============================================================================
+
+namespace {
+
+struct FDecodedArg {
+    ELogArgType type = ELogArgType::Int32;
+    uint64_t bits = 0;              // Integer, double or pointer value
+    const char* string = nullptr;
+    uint32_t stringLength = 0;
+};
+
+class FLogArgReader {
+public:
+    FLogArgReader(const uint8_t* args, size_t argsSize) : cursor(args), end(args + argsSize) {}
+    
+    bool Next(FDecodedArg& arg) {
+        if (cursor >= end) {
+            return false;
+        }
+    
+        arg.type = static_cast<ELogArgType>(*cursor++);
+        switch (arg.type) {
+            case ELogArgType::Int32:
+            case ELogArgType::UInt32: {
+                uint32_t value = 0;
+                if (!Read(&value, sizeof(value))) {
+                    return false;
+                }
+                arg.bits = arg.type == ELogArgType::Int32
+                    ? static_cast<uint64_t>(static_cast<int64_t>(static_cast<int32_t>(value)))
+                    : value;
+                return true;
+            }
+            case ELogArgType::Int64:
+            case ELogArgType::UInt64:
+            case ELogArgType::Double:
+            case ELogArgType::Pointer:
+                return Read(&arg.bits, sizeof(arg.bits));
+            case ELogArgType::String:
+                if (!Read(&arg.stringLength, sizeof(arg.stringLength)) ||
+                    arg.stringLength > static_cast<size_t>(end - cursor)) {
+                    return false;
+                }
+                arg.string = reinterpret_cast<const char*>(cursor);
+                cursor += arg.stringLength;
+                return true;
+        }
+        return false;
+    }
+
+private:
+    bool Read(void* out, size_t size) {
+        if (size > static_cast<size_t>(end - cursor)) {
+            cursor = end;
+            return false;
+        }
+        std::memcpy(out, cursor, size);
+        cursor += size;
+        return true;
+    }
+    
+    const uint8_t* cursor;
+    const uint8_t* end;
+};
+
+template<typename... ArgTypes>
+void AppendFormatted(std::string& out, const char* spec, ArgTypes... args) {
+    char buffer[128];
+    int length = std::snprintf(buffer, sizeof(buffer), spec, args...);
+    if (length < 0) {
+        return;
+    }
+    if (static_cast<size_t>(length) < sizeof(buffer)) {
+        out.append(buffer, static_cast<size_t>(length));
+        return;
+    }
+    size_t offset = out.size();
+    out.resize(offset + static_cast<size_t>(length) + 1);
+    std::snprintf(&out[offset], static_cast<size_t>(length) + 1, spec, args...);
+    out.resize(offset + static_cast<size_t>(length));
+}
+
+int64_t ArgAsSigned(const FDecodedArg& arg) {
+    switch (arg.type) {
+        case ELogArgType::UInt32: return static_cast<int32_t>(static_cast<uint32_t>(arg.bits));
+        case ELogArgType::Double: {
+            double value;
+            std::memcpy(&value, &arg.bits, sizeof(value));
+            return static_cast<int64_t>(value);
+        }
+        default: return static_cast<int64_t>(arg.bits);
+    }
+}
+
+uint64_t ArgAsUnsigned(const FDecodedArg& arg) {
+    switch (arg.type) {
+        case ELogArgType::Int32: return static_cast<uint32_t>(arg.bits);
+        case ELogArgType::Double: return static_cast<uint64_t>(ArgAsSigned(arg));
+        default: return arg.bits;
+    }
+}
+
+double ArgAsDouble(const FDecodedArg& arg) {
+    switch (arg.type) {
+        case ELogArgType::Double: {
+            double value;
+            std::memcpy(&value, &arg.bits, sizeof(value));
+            return value;
+        }
+        case ELogArgType::UInt32:
+        case ELogArgType::UInt64:
+        case ELogArgType::Pointer: return static_cast<double>(arg.bits);
+        default: return static_cast<double>(static_cast<int64_t>(arg.bits));
+    }
+}
+
+// Format one conversion. 'spec' holds "%<flags><width><.precision>" without length
+// modifier; the modifier matching the stored type is added here.
+void AppendConversion(std::string& out, std::string& spec, char conversion, const FDecodedArg& arg) {
+    switch (conversion) {
+        case 'd':
+        case 'i':
+            if (arg.type == ELogArgType::String) {
+                break;
+            }
+            spec += "lld";
+            AppendFormatted(out, spec.c_str(), static_cast<long long>(ArgAsSigned(arg)));
+            return;
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            if (arg.type == ELogArgType::String) {
+                break;
+            }
+            spec += "ll";
+            spec += conversion;
+            AppendFormatted(out, spec.c_str(), static_cast<unsigned long long>(ArgAsUnsigned(arg)));
+            return;
+        case 'c':
+            spec += 'c';
+            AppendFormatted(out, spec.c_str(), static_cast<int>(ArgAsSigned(arg)));
+            return;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (arg.type == ELogArgType::String) {
+                break;
+            }
+            spec += conversion;
+            AppendFormatted(out, spec.c_str(), ArgAsDouble(arg));
+            return;
+        case 'p':
+            if (arg.type == ELogArgType::String) {
+                break;
+            }
+            spec += 'p';
+            AppendFormatted(out, spec.c_str(), reinterpret_cast<void*>(static_cast<uintptr_t>(arg.bits)));
+            return;
+        default:
+            break;
+    }
+    
+    // %s, or a string passed where a number was expected: print it as a string
+    if (arg.type == ELogArgType::String) {
+        std::string value(arg.string, arg.stringLength);
+        spec += 's';
+        AppendFormatted(out, spec.c_str(), value.c_str());
+    } else if (arg.type == ELogArgType::Double) {
+        AppendFormatted(out, "%g", ArgAsDouble(arg));
+    } else if (arg.type == ELogArgType::Pointer) {
+        AppendFormatted(out, "%p", reinterpret_cast<void*>(static_cast<uintptr_t>(arg.bits)));
+    } else {
+        AppendFormatted(out, "%lld", static_cast<long long>(ArgAsSigned(arg)));
+    }
+}
+
+} // namespace
+
+void LogArgs::FormatDeferred(std::string& out, const char* format, const uint8_t* args, size_t argsSize) {
+    FLogArgReader reader(args, argsSize);
+    std::string spec;
+    const char* cursor = format;
+    
+    while (*cursor != '\0') {
+        const char* percent = std::strchr(cursor, '%');
+        if (percent == nullptr) {
+            out.append(cursor);
+            return;
+        }
+        out.append(cursor, static_cast<size_t>(percent - cursor));
+        cursor = percent + 1;
+    
+        if (*cursor == '%') {
+            out.push_back('%');
+            cursor++;
+            continue;
+        }
+    
+        // %[flags][width][.precision][length]conversion
+        spec.assign("%");
+        while (*cursor != '\0' && std::strchr("-+ #0", *cursor) != nullptr) {
+            spec += *cursor++;
+        }
+    
+        FDecodedArg arg;
+        if (*cursor == '*') {
+            cursor++;
+            if (reader.Next(arg)) {
+                spec += std::to_string(ArgAsSigned(arg));
+            }
+        }
+        while (std::isdigit(static_cast<unsigned char>(*cursor))) {
+            spec += *cursor++;
+        }
+    
+        if (*cursor == '.') {
+            spec += *cursor++;
+            if (*cursor == '*') {
+                cursor++;
+                if (reader.Next(arg)) {
+                    spec += std::to_string(ArgAsSigned(arg));
+                }
+            }
+            while (std::isdigit(static_cast<unsigned char>(*cursor))) {
+                spec += *cursor++;
+            }
+        }
+    
+        while (*cursor != '\0' && std::strchr("hlLqjzt", *cursor) != nullptr) {
+            cursor++;
+        }
+    
+        char conversion = *cursor;
+        if (conversion == '\0') {
+            return;
+        }
+        cursor++;
+    
+        if (conversion == 'n') {
+            continue;
+        }
+    
+        if (!reader.Next(arg)) {
+            out.append("<missing>");
+            continue;
+        }
+        AppendConversion(out, spec, conversion, arg);
+    }
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <iostream>
@@ -7,21 +10,60 @@
 #include <chrono>
 #include <iomanip>
 #include <mutex>
+#include "LogArgs.h"
+#include "LogFlightRecorder.h"
+#include "LogVerbosity.h"
 
 // Log categories (similar to UE_LOG categories)
-#define DEFINE_LOG_CATEGORY_STATIC(CategoryName) \
-    static const char* GetLogCategory() { return #CategoryName; }
-
-// Log verbosity levels (similar to UE_LOG verbosity)
-enum class ELogVerbosity : uint8_t {
-    NoLogging = 0,
-    Fatal,      // Always logs, crashes the game
-    Error,      // Error level
-    Warning,    // Warning level
-    Display,    // Display level
-    Log,        // Log level
-    Verbose,    // Verbose level
-    VeryVerbose // Very verbose level
+// CompileTimeVerbosity is the most verbose level compiled in for the category: UE_LOG_*
+// calls above it generate no code. The runtime threshold lives in Instance.
+#define DEFINE_LOG_CATEGORY_STATIC(CategoryName, CompileTimeVerbosity) \
+    static const char* GetLogCategory() { return #CategoryName; } \
+    static constexpr ELogVerbosity CompiledInVerbosity = \
+        FLogCategory::ClampCompiledInVerbosity(ELogVerbosity::CompileTimeVerbosity); \
+    static inline FLogCategory Instance{#CategoryName}
+
+// Most verbose level compiled into any category. Shipping builds lower it
+// (e.g. -DLOG_COMPILED_IN_VERBOSITY=Log) to strip Verbose and VeryVerbose call sites.
+#ifndef LOG_COMPILED_IN_VERBOSITY
+#define LOG_COMPILED_IN_VERBOSITY VeryVerbose
+#endif
+
+// Runtime verbosity of one log category (the Instance member of its LogCategories
+// struct). Categories register by name so the threshold can be changed with
+// FLog::SetCategoryVerbosity, the -LogCmds= command line option or the console.
+class FLogCategory {
+public:
+    explicit FLogCategory(const char* categoryName);
+    
+    FLogCategory(const FLogCategory&) = delete;
+    FLogCategory& operator=(const FLogCategory&) = delete;
+    
+    const char* GetName() const { return name; }
+    
+    ELogVerbosity GetVerbosity() const {
+        return static_cast<ELogVerbosity>(verbosity.load(std::memory_order_relaxed));
+    }
+    
+    // Checked by the UE_LOG_* macros before any argument is evaluated
+    bool IsActive(ELogVerbosity messageVerbosity) const {
+        return static_cast<uint8_t>(messageVerbosity) <= verbosity.load(std::memory_order_relaxed);
+    }
+    
+    // Fatal is always compiled in; nothing above LOG_COMPILED_IN_VERBOSITY is
+    static constexpr ELogVerbosity ClampCompiledInVerbosity(ELogVerbosity compileTimeVerbosity) {
+        constexpr ELogVerbosity globalVerbosity = ELogVerbosity::LOG_COMPILED_IN_VERBOSITY;
+        return compileTimeVerbosity < ELogVerbosity::Fatal ? ELogVerbosity::Fatal
+             : compileTimeVerbosity > globalVerbosity ? globalVerbosity
+             : compileTimeVerbosity;
+    }
+
+private:
+    friend class FLog;
+    
+    const char* name;
+    std::atomic<uint8_t> verbosity;
+    bool bOverridden = false;   // Set explicitly instead of following FLog::SetVerbosity (guarded by the registry lock)
 };
 
 // Color codes for terminal output
@@ -35,20 +77,66 @@ namespace LogColors {
     constexpr const char* Verbose = "\033[90m";  // Dark gray
 }
 
+// When the asynchronous writer flushes console and file output
+enum class ELogFlushPolicy : uint8_t {
+    Interval,   // Flush at most every flush interval (and for records at the sync flush verbosity)
+    EveryBatch  // Flush after every batch the writer thread writes
+};
+
 // Main logging class (similar to UE_LOG)
 class FLog {
 public:
     static void Initialize(const std::string& logFile = "Engine.log");
     static void Shutdown();
     
-    // Set minimum verbosity level
-    static void SetVerbosity(ELogVerbosity verbosity) { MinVerbosity = verbosity; }
+    // Set minimum verbosity level (applies to every category not set explicitly)
+    static void SetVerbosity(ELogVerbosity verbosity);
     static ELogVerbosity GetVerbosity() { return MinVerbosity; }
     
+    // Per-category runtime verbosity. Names match with or without the "Log" prefix and
+    // ignoring case ("LogRender", "render"); names of categories that are not registered
+    // yet are remembered and applied when they register. Fatal is never filtered.
+    static void SetCategoryVerbosity(const std::string& categoryName, ELogVerbosity verbosity);
+    static void ResetCategoryVerbosities();
+    static bool IsCategoryActive(const char* categoryName, ELogVerbosity verbosity);
+    
+    // Apply "Category Verbosity" pairs separated by commas, e.g. "LogRender Verbose, LogRHI off".
+    // "global <Verbosity>" calls SetVerbosity and "reset" drops the per-category settings.
+    // Returns false (with a description in outError) on the first invalid entry.
+    static bool ApplyLogCommands(const std::string& commands, std::string* outError = nullptr);
+    
+    // Apply -LogCmds="..." (or -LogCmds=...) from the command line
+    static void ParseCommandLine(int argc, char* argv[]);
+    
+    // "Log", "verbose", "off"/"NoLogging"... Returns false if the name is unknown
+    static bool ParseVerbosity(const std::string& text, ELogVerbosity& outVerbosity);
+    
+    // One "Category: Verbosity" line per registered category
+    static std::string DescribeCategories();
+    
     // Enable/disable console output
     static void SetConsoleOutput(bool enabled) { bConsoleOutput = enabled; }
     static void SetFileOutput(bool enabled) { bFileOutput = enabled; }
     
+    // Asynchronous mode: log calls format into a per-thread lock-free ring and a
+    // background writer thread batches the records to console and file. Switch it
+    // while no other thread is logging (before starting / after stopping them).
+    static void SetAsyncMode(bool enabled);
+    static bool IsAsyncMode() { return bAsyncMode.load(std::memory_order_acquire); }
+    
+    // Flush policy of the async writer (intervalMs applies to ELogFlushPolicy::Interval)
+    static void SetFlushPolicy(ELogFlushPolicy policy, uint32_t intervalMs = 100);
+    
+    // In async mode, records at this verbosity or more severe block the caller until
+    // they are written and flushed (default: Error, so Fatal and Error are synchronous)
+    static void SetSyncFlushVerbosity(ELogVerbosity verbosity) { SyncFlushVerbosity = verbosity; }
+    
+    // Block until everything logged so far is written and flushed
+    static void Flush();
+    
+    // Monotonic timestamp (nanoseconds) stored in log records
+    static int64_t GetTimestamp();
+    
     // Log functions (similar to UE_LOG) - wrapper for InternalLog
     static void Log(ELogVerbosity verbosity, const char* category, const char* format, ...);
     
@@ -59,78 +147,235 @@ public:
     static void Display(const char* category, const char* format, ...);
     static void Info(const char* category, const char* format, ...);
     static void Verbose(const char* category, const char* format, ...);
+    
+    // Same, given the category object (LogCategories::Core::Instance): a filtered-out
+    // call costs one relaxed load instead of a lookup by name
+    static void Log(ELogVerbosity verbosity, const FLogCategory& category, const char* format, ...);
+    static void Fatal(const FLogCategory& category, const char* format, ...);
+    static void Error(const FLogCategory& category, const char* format, ...);
+    static void Warning(const FLogCategory& category, const char* format, ...);
+    static void Display(const FLogCategory& category, const char* format, ...);
+    static void Info(const FLogCategory& category, const char* format, ...);
+    static void Verbose(const FLogCategory& category, const char* format, ...);
+    
+    // Used by the UE_LOG_* macros. In async mode the call site only stores the format
+    // string pointer, a timestamp and the raw argument bytes (LogArgs.h); the writer
+    // thread formats them. The format must be a string literal. Otherwise (or if the
+    // record does not fit) it formats synchronously like the functions above.
+    template<typename... ArgTypes>
+    static void LogDeferred(ELogVerbosity verbosity, const char* category, const char* format,
+                            const ArgTypes&... args) {
+        if (FLogFlightRecorder::IsCapturing(verbosity)) {
+            FLogFlightRecorder::RecordDeferred(verbosity, category, format, args...);
+        }
+        if (bAsyncMode.load(std::memory_order_acquire)) {
+            size_t argsSize = LogArgs::EncodedSizeOf(args...);
+            uint8_t* payload = BeginDeferredRecord(argsSize, verbosity, category, format);
+            if (payload != nullptr) {
+                LogArgs::EncodeAll(payload, args...);
+                CommitDeferredRecord(argsSize, verbosity);
+                return;
+            }
+        }
+        LogUnchecked(verbosity, category, format, args...);
+    }
+    
+    // Binary log file: records are stored with their arguments unformatted plus a
+    // table of format strings, which shrinks the file considerably. Decode it with the
+    // logdecode tool. Set before Initialize; requires async mode to defer formatting.
+    static void SetBinaryFileOutput(bool enabled) { bBinaryFileOutput = enabled; }
+    static bool IsBinaryFileOutput() { return bBinaryFileOutput; }
+    
+    static const char* GetVerbosityString(ELogVerbosity verbosity);
 
 private:
+    friend class FLogCategory;
+    static void RegisterCategory(FLogCategory& category);
+    
+    static void LogUnchecked(ELogVerbosity verbosity, const char* category, const char* format, ...);
+    
+    // Reserve a deferred record in the calling thread's ring and return where its
+    // arguments go (nullptr: use the synchronous path)
+    static uint8_t* BeginDeferredRecord(size_t argsSize, ELogVerbosity verbosity,
+                                        const char* category, const char* format);
+    static void CommitDeferredRecord(size_t argsSize, ELogVerbosity verbosity);
+    
+    // Category check and flight recorder capture for the printf-style functions
+    static void LogChecked(ELogVerbosity verbosity, bool bCategoryActive, const char* category,
+                           const char* format, va_list args);
     static void InternalLog(ELogVerbosity verbosity, const char* category, const char* format, va_list args);
+    static void WriteSync(ELogVerbosity verbosity, const char* category, const char* format, va_list args);
+    static bool EnqueueAsync(ELogVerbosity verbosity, const char* category, const char* format, va_list args);
+    static void AsyncWriterMain();
+    static void WriteAsyncBatch(bool bFlush);
+    static void DrainIfAsyncStopped();
+    static void WriteFileLine(int64_t timestamp, ELogVerbosity verbosity, const char* category,
+                              const char* text, size_t length);
+    [[noreturn]] static void TerminateAfterFatal();
     static std::string FormatString(const char* format, va_list args);
-    static const char* GetVerbosityString(ELogVerbosity verbosity);
+    static size_t FormatLinePrefix(char* out, size_t outSize, int64_t timestamp,
+                                   ELogVerbosity verbosity, const char* category);
     static const char* GetVerbosityColor(ELogVerbosity verbosity);
     
     static ELogVerbosity MinVerbosity;
+    static ELogVerbosity SyncFlushVerbosity;
+    static std::atomic<bool> bAsyncMode;
     static bool bConsoleOutput;
     static bool bFileOutput;
+    static bool bBinaryFileOutput;
     static std::ofstream LogFile;
     static std::mutex LogMutex;
 };
 
-// UE_LOG style macros - These call the variadic functions directly
+// Call-site state of the rate-limited macros (also usable directly to guard a block
+// of several log lines). Concurrent callers may occasionally both pass or lose a
+// count; the counters are plain loads and stores to keep the fast path cheap.
+class FLogOnceState {
+public:
+    constexpr FLogOnceState() = default;
+    
+    bool ShouldLog() {
+        return !bLogged.load(std::memory_order_relaxed) && !bLogged.exchange(true, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> bLogged{false};
+};
+
+class FLogEveryNState {
+public:
+    constexpr FLogEveryNState() = default;
+    
+    bool ShouldLog(uint32_t n) {
+        uint32_t count = callCount.load(std::memory_order_relaxed);
+        callCount.store(count + 1 < n ? count + 1 : 0, std::memory_order_relaxed);
+        return count == 0;
+    }
+
+private:
+    std::atomic<uint32_t> callCount{0};
+};
+
+class FLogThrottleState {
+public:
+    constexpr FLogThrottleState() = default;
+    
+    bool ShouldLog(uint32_t intervalMs) {
+        int64_t now = FLog::GetTimestamp();
+        int64_t nextAllowed = nextAllowedTimestamp.load(std::memory_order_relaxed);
+        return now >= nextAllowed &&
+               nextAllowedTimestamp.compare_exchange_strong(nextAllowed, now + int64_t(intervalMs) * 1000000,
+                                                            std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> nextAllowedTimestamp{0};
+};
+
+// UE_LOG style macros - Deferred formatting in async mode (see FLog::LogDeferred).
+// The format must be a string literal: only its pointer is stored.
+// Levels above the category's CompiledInVerbosity generate no code, and the runtime
+// threshold is tested before the arguments are evaluated. Records the category filters
+// out still reach the crash flight recorder down to its capture verbosity.
+#define UE_LOG_CHECKED(Category, VerbosityValue, Format, ...) \
+    do { \
+        if constexpr (VerbosityValue <= Category::CompiledInVerbosity) { \
+            if (Category::Instance.IsActive(VerbosityValue)) { \
+                FLog::LogDeferred(VerbosityValue, Category::GetLogCategory(), "" Format, ##__VA_ARGS__); \
+            } else if (FLogFlightRecorder::IsCapturing(VerbosityValue)) { \
+                FLogFlightRecorder::RecordDeferred(VerbosityValue, Category::GetLogCategory(), "" Format, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
 #define UE_LOG(Category, Verbosity, Format, ...) \
-    FLog::Log(ELogVerbosity::Verbosity, Category::GetLogCategory(), Format, ##__VA_ARGS__)
+    UE_LOG_CHECKED(Category, ELogVerbosity::Verbosity, Format, ##__VA_ARGS__)
 
 #define UE_LOG_FATAL(Category, Format, ...) \
-    FLog::Fatal(Category::GetLogCategory(), Format, ##__VA_ARGS__)
+    FLog::LogDeferred(ELogVerbosity::Fatal, Category::GetLogCategory(), "" Format, ##__VA_ARGS__)
 
 #define UE_LOG_ERROR(Category, Format, ...) \
-    FLog::Error(Category::GetLogCategory(), Format, ##__VA_ARGS__)
+    UE_LOG_CHECKED(Category, ELogVerbosity::Error, Format, ##__VA_ARGS__)
 
 #define UE_LOG_WARNING(Category, Format, ...) \
-    FLog::Warning(Category::GetLogCategory(), Format, ##__VA_ARGS__)
+    UE_LOG_CHECKED(Category, ELogVerbosity::Warning, Format, ##__VA_ARGS__)
 
 #define UE_LOG_DISPLAY(Category, Format, ...) \
-    FLog::Display(Category::GetLogCategory(), Format, ##__VA_ARGS__)
+    UE_LOG_CHECKED(Category, ELogVerbosity::Display, Format, ##__VA_ARGS__)
 
 #define UE_LOG_INFO(Category, Format, ...) \
-    FLog::Info(Category::GetLogCategory(), Format, ##__VA_ARGS__)
+    UE_LOG_CHECKED(Category, ELogVerbosity::Log, Format, ##__VA_ARGS__)
 
 #define UE_LOG_VERBOSE(Category, Format, ...) \
-    FLog::Verbose(Category::GetLogCategory(), Format, ##__VA_ARGS__)
+    UE_LOG_CHECKED(Category, ELogVerbosity::Verbose, Format, ##__VA_ARGS__)
+
+// Rate-limited logging: per-call-site state in a constant-initialized static (no
+// initialization guard), tested after the category threshold. Calls the limit (or the
+// category) suppresses still go to the crash flight recorder, so a dump keeps the spam
+// leading up to a crash; below the recorder's capture verbosity a suppressed call costs
+// a couple of relaxed loads and the arguments are not evaluated.
+//   UE_LOG_ONCE(LogCategories::RHI, Log, "First frame submitted");
+//   UE_LOG_EVERY_N(LogCategories::RHI, Warning, 100, "Swap chain out of date (%d)", result);
+//   UE_LOG_THROTTLED(LogCategories::UI, Warning, 5000, "No render data available");
+#define UE_LOG_ONCE(Category, Verbosity, Format, ...) \
+    UE_LOG_RATE_LIMITED(Category, ELogVerbosity::Verbosity, FLogOnceState, (), Format, ##__VA_ARGS__)
+
+// The 1st, (N+1)th, (2N+1)th... call
+#define UE_LOG_EVERY_N(Category, Verbosity, N, Format, ...) \
+    UE_LOG_RATE_LIMITED(Category, ELogVerbosity::Verbosity, FLogEveryNState, (N), Format, ##__VA_ARGS__)
+
+// At most once every IntervalMs milliseconds
+#define UE_LOG_THROTTLED(Category, Verbosity, IntervalMs, Format, ...) \
+    UE_LOG_RATE_LIMITED(Category, ELogVerbosity::Verbosity, FLogThrottleState, (IntervalMs), Format, ##__VA_ARGS__)
+
+#define UE_LOG_RATE_LIMITED(Category, VerbosityValue, StateType, StateArgs, Format, ...) \
+    do { \
+        if constexpr (VerbosityValue <= Category::CompiledInVerbosity) { \
+            static StateType logCallSiteState; \
+            if (Category::Instance.IsActive(VerbosityValue) && logCallSiteState.ShouldLog StateArgs) { \
+                FLog::LogDeferred(VerbosityValue, Category::GetLogCategory(), "" Format, ##__VA_ARGS__); \
+            } else if (FLogFlightRecorder::IsCapturing(VerbosityValue)) { \
+                FLogFlightRecorder::RecordDeferred(VerbosityValue, Category::GetLogCategory(), "" Format, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
 
 // Log categories (similar to UE_LOG categories)
 namespace LogCategories {
     struct Core {
-        DEFINE_LOG_CATEGORY_STATIC(LogCore);
+        DEFINE_LOG_CATEGORY_STATIC(LogCore, VeryVerbose);
     };
     
     struct Render {
-        DEFINE_LOG_CATEGORY_STATIC(LogRender);
+        DEFINE_LOG_CATEGORY_STATIC(LogRender, VeryVerbose);
     };
     
     struct RHI {
-        DEFINE_LOG_CATEGORY_STATIC(LogRHI);
+        DEFINE_LOG_CATEGORY_STATIC(LogRHI, VeryVerbose);
     };
     
     struct World {
-        DEFINE_LOG_CATEGORY_STATIC(LogWorld);
+        DEFINE_LOG_CATEGORY_STATIC(LogWorld, VeryVerbose);
     };
     
     struct Actor {
-        DEFINE_LOG_CATEGORY_STATIC(LogActor);
+        DEFINE_LOG_CATEGORY_STATIC(LogActor, VeryVerbose);
     };
     
     struct Material {
-        DEFINE_LOG_CATEGORY_STATIC(LogMaterial);
+        DEFINE_LOG_CATEGORY_STATIC(LogMaterial, VeryVerbose);
     };
     
     struct Blueprint {
-        DEFINE_LOG_CATEGORY_STATIC(LogBlueprint);
+        DEFINE_LOG_CATEGORY_STATIC(LogBlueprint, VeryVerbose);
     };
     
     struct Asset {
-        DEFINE_LOG_CATEGORY_STATIC(LogAsset);
+        DEFINE_LOG_CATEGORY_STATIC(LogAsset, VeryVerbose);
     };
     
     struct UI {
-        DEFINE_LOG_CATEGORY_STATIC(LogUI);
+        DEFINE_LOG_CATEGORY_STATIC(LogUI, VeryVerbose);
     };
 }
 
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// Deferred formatting of log arguments.
+// In async mode UE_LOG_* does not run vsnprintf: the call site stores the format
+// string pointer plus the raw argument bytes, and the writer thread (or the
+// logdecode tool, for binary log files) formats them later with FormatDeferred.
+//
+// Encoding: for each argument a one-byte ELogArgType tag followed by its value.
+// Integers keep their promoted printf width (32 or 64 bits) so %u/%x of a
+// negative int print the same as printf. Strings are copied (the caller's
+// buffer may be gone by the time the record is formatted).
+
+enum class ELogArgType : uint8_t {
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Double,
+    String,     // uint32 length + bytes (no terminator)
+    Pointer     // uint64
+};
+
+namespace LogArgs {
+
+template<typename T>
+struct TArgTraits {
+    using DecayedType = std::decay_t<T>;
+
+    static constexpr bool bIsString =
+        std::is_same<DecayedType, const char*>::value || std::is_same<DecayedType, char*>::value;
+    static constexpr bool bIsPointer = std::is_pointer<DecayedType>::value || std::is_null_pointer<DecayedType>::value;
+    static constexpr bool bIsSupported =
+        std::is_arithmetic<DecayedType>::value || std::is_enum<DecayedType>::value || bIsPointer;
+};
+
+template<typename T>
+size_t EncodedSize(const T& value) {
+    using Traits = TArgTraits<T>;
+    static_assert(Traits::bIsSupported, "Unsupported UE_LOG argument type (pass strings as const char*)");
+
+    if constexpr (Traits::bIsString) {
+        return 1 + sizeof(uint32_t) + (value != nullptr ? std::strlen(value) : 0);
+    } else if constexpr (Traits::bIsPointer || std::is_floating_point<typename Traits::DecayedType>::value) {
+        return 1 + 8;
+    } else {
+        return 1 + (sizeof(value) > 4 ? 8 : 4);
+    }
+}
+
+// String literals and char arrays are never null: no null test (it warns with
+// -Wnonnull-compare at nearly every UE_LOG call site)
+template<size_t N>
+size_t EncodedSize(const char (&value)[N]) {
+    return 1 + sizeof(uint32_t) + std::strlen(value);
+}
+
+inline uint8_t* EncodeRaw(uint8_t* out, ELogArgType type, const void* data, size_t size) {
+    *out++ = static_cast<uint8_t>(type);
+    std::memcpy(out, data, size);
+    return out + size;
+}
+
+inline uint8_t* EncodeString(uint8_t* out, const char* value, uint32_t length) {
+    out = EncodeRaw(out, ELogArgType::String, &length, sizeof(length));
+    if (length > 0) {
+        std::memcpy(out, value, length);
+    }
+    return out + length;
+}
+
+template<typename T>
+uint8_t* Encode(uint8_t* out, const T& value) {
+    using Traits = TArgTraits<T>;
+    using DecayedType = typename Traits::DecayedType;
+
+    if constexpr (Traits::bIsString) {
+        return EncodeString(out, value, value != nullptr ? static_cast<uint32_t>(std::strlen(value)) : 0);
+    } else if constexpr (std::is_null_pointer<DecayedType>::value) {
+        uint64_t address = 0;
+        return EncodeRaw(out, ELogArgType::Pointer, &address, sizeof(address));
+    } else if constexpr (Traits::bIsPointer) {
+        uint64_t address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+        return EncodeRaw(out, ELogArgType::Pointer, &address, sizeof(address));
+    } else if constexpr (std::is_floating_point<DecayedType>::value) {
+        double promoted = static_cast<double>(value);
+        return EncodeRaw(out, ELogArgType::Double, &promoted, sizeof(promoted));
+    } else {
+        // Integers and enums, with printf's default promotions
+        using IntegerType = typename std::conditional_t<std::is_enum<DecayedType>::value,
+                                                        std::underlying_type<DecayedType>,
+                                                        std::common_type<DecayedType>>::type;
+        if constexpr (sizeof(IntegerType) > 4) {
+            if constexpr (std::is_signed<IntegerType>::value) {
+                int64_t promoted = static_cast<int64_t>(value);
+                return EncodeRaw(out, ELogArgType::Int64, &promoted, sizeof(promoted));
+            } else {
+                uint64_t promoted = static_cast<uint64_t>(value);
+                return EncodeRaw(out, ELogArgType::UInt64, &promoted, sizeof(promoted));
+            }
+        } else if constexpr (std::is_signed<IntegerType>::value || sizeof(IntegerType) < 4) {
+            int32_t promoted = static_cast<int32_t>(value);
+            return EncodeRaw(out, ELogArgType::Int32, &promoted, sizeof(promoted));
+        } else {
+            uint32_t promoted = static_cast<uint32_t>(value);
+            return EncodeRaw(out, ELogArgType::UInt32, &promoted, sizeof(promoted));
+        }
+    }
+}
+
+template<size_t N>
+uint8_t* Encode(uint8_t* out, const char (&value)[N]) {
+    return EncodeString(out, value, static_cast<uint32_t>(std::strlen(value)));
+}
+
+template<typename... ArgTypes>
+size_t EncodedSizeOf(const ArgTypes&... args) {
+    return (size_t{0} + ... + EncodedSize(args));
+}
+
+template<typename... ArgTypes>
+uint8_t* EncodeAll(uint8_t* out, const ArgTypes&... args) {
+    ((out = Encode(out, args)), ...);
+    return out;
+}
+
+// Append the printf-style expansion of 'format' with the encoded arguments to 'out'.
+// Missing or mismatched arguments are converted as sensibly as possible, never read
+// past argsSize. Implemented in Log.cpp (shared with the logdecode tool).
+void FormatDeferred(std::string& out, const char* format, const uint8_t* args, size_t argsSize);
+
+} // namespace LogArgs
+
+// Binary log file (FLog::SetBinaryFileOutput), decoded by Tools/logdecode.cpp.
+// Little-endian, unaligned. The header is followed by a sequence of entries, each
+// starting with a one-byte ELogFileEntry:
+//   String:   uint32 id, uint32 length, bytes          (format/category table)
+//   Deferred: int64 timestamp, uint32 thread, uint32 categoryId, uint32 formatId,
+//             uint8 verbosity, uint32 argsSize, LogArgs-encoded arguments
+//   Text:     int64 timestamp, uint32 thread, uint32 categoryId, uint8 verbosity,
+//             uint32 length, bytes                     (already formatted message)
+// A string is always defined before the first entry that references it.
+namespace LogBinaryFile {
+    constexpr char MAGIC[8] = { 'U', 'E', 'L', 'O', 'G', 'B', 'I', 'N' };
+    constexpr uint32_t VERSION = 1;
+
+    struct FFileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+        int64_t steadyAnchor;   // FLog::GetTimestamp() at...
+        int64_t systemAnchor;   // ...this wall-clock time (ns since the Unix epoch)
+    };
+
+    enum class ELogFileEntry : uint8_t {
+        String = 1,
+        Deferred = 2,
+        Text = 3
+    };
+}
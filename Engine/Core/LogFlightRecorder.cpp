@@ -0,0 +1,345 @@
+#include "LogFlightRecorder.h"
+#include "Log.h"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Static member initialization
+std::atomic<uint8_t> FLogFlightRecorder::CaptureVerbosity{0};
+std::atomic<FFlightRecord*> FLogFlightRecorder::Records{nullptr};
+size_t FLogFlightRecorder::RecordMask = 0;
+std::atomic<uint64_t> FLogFlightRecorder::NextSequence{0};
+std::atomic<bool> FLogFlightRecorder::bDumped{false};
+
+namespace {
+
+constexpr size_t FLIGHT_DUMP_PATH_SIZE = 512;
+constexpr size_t FLIGHT_DUMP_BUFFER_SIZE = 64 * 1024;
+
+// Open addressing table (pointer -> string id); twice the largest ring
+constexpr size_t FLIGHT_DUMP_STRING_TABLE_SIZE = 1 << 16;
+
+// Everything the dump needs lives in static storage: no allocation in a signal handler
+char DumpPath[FLIGHT_DUMP_PATH_SIZE] = {};
+int64_t SteadyAnchor = 0;
+int64_t SystemAnchor = 0;
+
+std::atomic<uint32_t> NextThreadIndex{0};
+
+uint32_t GetRecorderThreadIndex() {
+    thread_local uint32_t threadIndex = NextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    return threadIndex;
+}
+
+int OpenDumpFile(const char* path) {
+    #ifdef _WIN32
+    return _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+    #else
+    return open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    #endif
+}
+
+void WriteToFile(int file, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        #ifdef _WIN32
+        int written = _write(file, bytes, static_cast<unsigned int>(size));
+        #else
+        ssize_t written = write(file, bytes, size);
+        #endif
+        if (written <= 0) {
+            return;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void CloseDumpFile(int file) {
+    #ifdef _WIN32
+    _close(file);
+    #else
+    close(file);
+    #endif
+}
+
+// Writes the binary log format (LogArgs.h) through a static buffer
+class FFlightDumpWriter {
+public:
+    void Begin(int dumpFile) {
+        file = dumpFile;
+        used = 0;
+        nextStringId = 1;
+        std::memset(stringKeys, 0, sizeof(stringKeys));
+    }
+
+    void End() {
+        FlushBuffer();
+        CloseDumpFile(file);
+    }
+
+    template<typename T>
+    void Write(const T& value) {
+        WriteBytes(&value, sizeof(T));
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        if (used + size > sizeof(buffer)) {
+            FlushBuffer();
+        }
+        if (size > sizeof(buffer)) {
+            WriteToFile(file, data, size);
+            return;
+        }
+        std::memcpy(buffer + used, data, size);
+        used += size;
+    }
+
+    // Id of a category/format string, writing its String entry the first time
+    uint32_t GetStringId(const char* text) {
+        if (text == nullptr) {
+            text = "";
+        }
+
+        size_t slot = (reinterpret_cast<uintptr_t>(text) >> 3) & (FLIGHT_DUMP_STRING_TABLE_SIZE - 1);
+        for (size_t probe = 0; probe < FLIGHT_DUMP_STRING_TABLE_SIZE; probe++) {
+            if (stringKeys[slot] == text) {
+                return stringIds[slot];
+            }
+            if (stringKeys[slot] == nullptr) {
+                break;
+            }
+            slot = (slot + 1) & (FLIGHT_DUMP_STRING_TABLE_SIZE - 1);
+        }
+
+        uint32_t id = nextStringId++;
+        if (stringKeys[slot] == nullptr) {
+            stringKeys[slot] = text;
+            stringIds[slot] = id;
+        }
+
+        uint32_t length = static_cast<uint32_t>(std::strlen(text));
+        Write(LogBinaryFile::ELogFileEntry::String);
+        Write(id);
+        Write(length);
+        WriteBytes(text, length);
+        return id;
+    }
+
+private:
+    void FlushBuffer() {
+        WriteToFile(file, buffer, used);
+        used = 0;
+    }
+
+    int file = -1;
+    size_t used = 0;
+    uint32_t nextStringId = 1;
+    const char* stringKeys[FLIGHT_DUMP_STRING_TABLE_SIZE];
+    uint32_t stringIds[FLIGHT_DUMP_STRING_TABLE_SIZE];
+    uint8_t buffer[FLIGHT_DUMP_BUFFER_SIZE];
+};
+
+FFlightDumpWriter DumpWriter;
+
+// Copy of one slot taken while no thread was rewriting it
+FFlightRecord DumpRecord;
+
+constexpr const char TRUNCATED_ARGUMENTS_SUFFIX[] = " [arguments did not fit in the flight recorder]";
+
+} // namespace
+
+void FLogFlightRecorder::Initialize(const std::string& dumpFile, ELogVerbosity captureVerbosity, size_t recordCount) {
+    if (IsInitialized()) {
+        SetCaptureVerbosity(captureVerbosity);
+        return;
+    }
+
+    size_t capacity = 64;
+    while (capacity < recordCount) {
+        capacity <<= 1;
+    }
+
+    size_t pathLength = std::min(dumpFile.size(), FLIGHT_DUMP_PATH_SIZE - 1);
+    std::memcpy(DumpPath, dumpFile.data(), pathLength);
+    DumpPath[pathLength] = '\0';
+
+    // Same anchors as the binary log header: logdecode converts timestamps to wall time
+    SteadyAnchor = FLog::GetTimestamp();
+    SystemAnchor = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // Never freed: the signal handler may read it until the process is gone
+    RecordMask = capacity - 1;
+    Records.store(new FFlightRecord[capacity], std::memory_order_release);
+
+    SetCaptureVerbosity(captureVerbosity);
+    InstallCrashHandlers();
+}
+
+void FLogFlightRecorder::SetCaptureVerbosity(ELogVerbosity verbosity) {
+    CaptureVerbosity.store(IsInitialized() ? static_cast<uint8_t>(verbosity) : 0, std::memory_order_relaxed);
+}
+
+FFlightRecord* FLogFlightRecorder::BeginRecord(ELogVerbosity verbosity, const char* category, const char* format,
+                                               uint64_t& outSequence) {
+    FFlightRecord* records = Records.load(std::memory_order_acquire);
+    if (records == nullptr) {
+        return nullptr;
+    }
+
+    outSequence = NextSequence.fetch_add(1, std::memory_order_relaxed);
+    FFlightRecord* record = &records[outSequence & RecordMask];
+
+    // Mark the slot as being written before touching its contents
+    record->sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    record->timestamp = FLog::GetTimestamp();
+    record->category = category;
+    record->format = format;
+    record->threadIndex = GetRecorderThreadIndex();
+    record->verbosity = static_cast<uint8_t>(verbosity);
+    record->bTruncated = 0;
+    record->argsSize = 0;
+    return record;
+}
+
+void FLogFlightRecorder::RecordText(ELogVerbosity verbosity, const char* category, const char* text, size_t length) {
+    uint64_t sequence = 0;
+    FFlightRecord* record = BeginRecord(verbosity, category, nullptr, sequence);
+    if (record == nullptr) {
+        return;
+    }
+
+    size_t storedLength = std::min(length, sizeof(record->args));
+    std::memcpy(record->args, text, storedLength);
+    record->argsSize = static_cast<uint16_t>(storedLength);
+    record->bTruncated = storedLength < length ? 1 : 0;
+    CommitRecord(record, sequence);
+}
+
+void FLogFlightRecorder::MarkFrame(const char* threadName, uint64_t frameNumber) {
+    RecordDeferred(ELogVerbosity::Log, threadName, "--- Frame %llu ---",
+                   static_cast<unsigned long long>(frameNumber));
+}
+
+bool FLogFlightRecorder::Dump() {
+    FFlightRecord* records = Records.load(std::memory_order_acquire);
+    if (records == nullptr || bDumped.exchange(true, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    int file = OpenDumpFile(DumpPath);
+    if (file < 0) {
+        return false;
+    }
+
+    DumpWriter.Begin(file);
+
+    LogBinaryFile::FFileHeader header{};
+    std::memcpy(header.magic, LogBinaryFile::MAGIC, sizeof(header.magic));
+    header.version = LogBinaryFile::VERSION;
+    header.steadyAnchor = SteadyAnchor;
+    header.systemAnchor = SystemAnchor;
+    DumpWriter.Write(header);
+
+    // Oldest to newest; slots being rewritten (or torn by a writer that lapped the ring) are skipped
+    const uint64_t end = NextSequence.load(std::memory_order_acquire);
+    const uint64_t capacity = RecordMask + 1;
+    const uint64_t begin = end > capacity ? end - capacity : 0;
+
+    for (uint64_t sequence = begin; sequence < end; sequence++) {
+        const FFlightRecord& slot = records[sequence & RecordMask];
+        if (slot.sequence.load(std::memory_order_acquire) != sequence + 1) {
+            continue;
+        }
+
+        DumpRecord.timestamp = slot.timestamp;
+        DumpRecord.category = slot.category;
+        DumpRecord.format = slot.format;
+        DumpRecord.threadIndex = slot.threadIndex;
+        DumpRecord.verbosity = slot.verbosity;
+        DumpRecord.bTruncated = slot.bTruncated;
+        DumpRecord.argsSize = std::min<uint16_t>(slot.argsSize, sizeof(slot.args));
+        std::memcpy(DumpRecord.args, slot.args, DumpRecord.argsSize);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence + 1) {
+            continue;
+        }
+
+        uint32_t categoryId = DumpWriter.GetStringId(DumpRecord.category);
+        if (DumpRecord.format != nullptr && !DumpRecord.bTruncated) {
+            uint32_t formatId = DumpWriter.GetStringId(DumpRecord.format);
+            uint32_t argsSize = DumpRecord.argsSize;
+            DumpWriter.Write(LogBinaryFile::ELogFileEntry::Deferred);
+            DumpWriter.Write(DumpRecord.timestamp);
+            DumpWriter.Write(DumpRecord.threadIndex);
+            DumpWriter.Write(categoryId);
+            DumpWriter.Write(formatId);
+            DumpWriter.Write(DumpRecord.verbosity);
+            DumpWriter.Write(argsSize);
+            DumpWriter.WriteBytes(DumpRecord.args, argsSize);
+            continue;
+        }
+
+        // Formatted text, or the bare format of a record whose arguments did not fit
+        const char* text = reinterpret_cast<const char*>(DumpRecord.args);
+        size_t textLength = DumpRecord.argsSize;
+        size_t suffixLength = 0;
+        if (DumpRecord.format != nullptr) {
+            text = DumpRecord.format;
+            textLength = std::strlen(text);
+            suffixLength = sizeof(TRUNCATED_ARGUMENTS_SUFFIX) - 1;
+        }
+
+        uint32_t length = static_cast<uint32_t>(textLength + suffixLength);
+        DumpWriter.Write(LogBinaryFile::ELogFileEntry::Text);
+        DumpWriter.Write(DumpRecord.timestamp);
+        DumpWriter.Write(DumpRecord.threadIndex);
+        DumpWriter.Write(categoryId);
+        DumpWriter.Write(DumpRecord.verbosity);
+        DumpWriter.Write(length);
+        DumpWriter.WriteBytes(text, textLength);
+        DumpWriter.WriteBytes(TRUNCATED_ARGUMENTS_SUFFIX, suffixLength);
+    }
+
+    DumpWriter.End();
+    return true;
+}
+
+const char* FLogFlightRecorder::GetDumpFile() {
+    return DumpPath;
+}
+
+void FLogFlightRecorder::InstallCrashHandlers() {
+    std::signal(SIGSEGV, &FLogFlightRecorder::HandleCrashSignal);
+    std::signal(SIGABRT, &FLogFlightRecorder::HandleCrashSignal);
+    std::signal(SIGFPE, &FLogFlightRecorder::HandleCrashSignal);
+    std::signal(SIGILL, &FLogFlightRecorder::HandleCrashSignal);
+}
+
+void FLogFlightRecorder::HandleCrashSignal(int signalNumber) {
+    // Restore the default action first: a crash inside Dump() must not recurse
+    std::signal(signalNumber, SIG_DFL);
+
+    if (Dump()) {
+        static const char DUMP_MESSAGE[] = "Crash: flight recorder written to ";
+        WriteToFile(2, DUMP_MESSAGE, sizeof(DUMP_MESSAGE) - 1);
+        WriteToFile(2, DumpPath, std::strlen(DumpPath));
+        WriteToFile(2, "\n", 1);
+    }
+
+    std::raise(signalNumber);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "LogArgs.h"
+#include "LogVerbosity.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Crash flight recorder: a fixed-size in-memory ring holding the most recent log
+// records and frame markers, including those below the category/global verbosity
+// (down to the capture verbosity). It is dumped to disk when a Fatal record is
+// logged and from SIGSEGV/SIGABRT/SIGFPE/SIGILL handlers, so crashes keep their
+// context even with synchronous flushing off (FLog::SetSyncFlushVerbosity).
+//
+// Records keep the deferred form (format pointer + LogArgs-encoded arguments) and
+// the dump is a binary log file (LogArgs.h): decode it with the logdecode tool.
+// Writing the dump only uses open/write, so it is safe from a signal handler.
+
+// One slot of the ring (4 cache lines)
+struct FFlightRecord {
+    std::atomic<uint64_t> sequence{0};  // Record number + 1 once written, 0 while being written
+    int64_t timestamp = 0;              // FLog::GetTimestamp()
+    const char* category = nullptr;
+    const char* format = nullptr;       // nullptr: args holds already formatted text
+    uint32_t threadIndex = 0;
+    uint8_t verbosity = 0;
+    uint8_t bTruncated = 0;             // The arguments did not fit and were dropped
+    uint16_t argsSize = 0;
+    uint8_t args[256 - 40];
+};
+
+static_assert(sizeof(FFlightRecord) == 256, "FFlightRecord should fill exactly four cache lines");
+
+class FLogFlightRecorder {
+public:
+    // Allocate the ring (recordCount rounded up to a power of two), start recording
+    // records at captureVerbosity or more severe, and install the crash handlers.
+    // Call once, early in main; the ring lives until the process exits.
+    static void Initialize(const std::string& dumpFile = "Engine-crash.ulog",
+                           ELogVerbosity captureVerbosity = ELogVerbosity::Verbose,
+                           size_t recordCount = 4096);
+
+    static void SetCaptureVerbosity(ELogVerbosity verbosity);
+
+    // Checked by the UE_LOG_* macros for records the category or a rate limit filters out
+    static bool IsCapturing(ELogVerbosity verbosity) {
+        return static_cast<uint8_t>(verbosity) <= CaptureVerbosity.load(std::memory_order_relaxed);
+    }
+
+    template<typename... ArgTypes>
+    static void RecordDeferred(ELogVerbosity verbosity, const char* category, const char* format,
+                               const ArgTypes&... args) {
+        uint64_t sequence = 0;
+        FFlightRecord* record = BeginRecord(verbosity, category, format, sequence);
+        if (record == nullptr) {
+            return;
+        }
+
+        size_t argsSize = LogArgs::EncodedSizeOf(args...);
+        if (argsSize <= sizeof(record->args)) {
+            LogArgs::EncodeAll(record->args, args...);
+            record->argsSize = static_cast<uint16_t>(argsSize);
+        } else {
+            record->bTruncated = 1;
+        }
+        CommitRecord(record, sequence);
+    }
+
+    // Already formatted message (printf-style FLog functions); truncated to fit a slot
+    static void RecordText(ELogVerbosity verbosity, const char* category, const char* text, size_t length);
+
+    // Frame boundary marker, recorded regardless of the capture verbosity
+    static void MarkFrame(const char* threadName, uint64_t frameNumber);
+
+    // Write the ring to the dump file. Only the first call writes; returns false if
+    // the recorder is not initialized, the file cannot be created or it was dumped.
+    static bool Dump();
+
+    static const char* GetDumpFile();
+
+    static bool IsInitialized() { return Records.load(std::memory_order_acquire) != nullptr; }
+
+private:
+    // Claim the next slot (overwriting the oldest record) and fill its header
+    static FFlightRecord* BeginRecord(ELogVerbosity verbosity, const char* category, const char* format,
+                                      uint64_t& outSequence);
+    static void CommitRecord(FFlightRecord* record, uint64_t sequence) {
+        record->sequence.store(sequence + 1, std::memory_order_release);
+    }
+
+    static void InstallCrashHandlers();
+    static void HandleCrashSignal(int signalNumber);
+
+    static std::atomic<uint8_t> CaptureVerbosity;
+    static std::atomic<FFlightRecord*> Records;
+    static size_t RecordMask;
+    static std::atomic<uint64_t> NextSequence;
+    static std::atomic<bool> bDumped;
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+// Lock-free single-producer / single-consumer byte ring for variable-size log records.
+// Each logging thread owns one ring (it is the only producer) and the asynchronous
+// writer thread is the only consumer. Records are 8-byte aligned and never wrap:
+// when the tail end of the buffer is too small the producer writes a padding record
+// (or, if not even a header fits, both sides skip the remaining bytes).
+
+// Kind of record stored in the ring
+enum class ELogRecordType : uint8_t {
+    Padding,    // Skip to the start of the buffer
+    Text,       // Header followed by the formatted message (payloadLength bytes)
+    Deferred    // Header followed by arguments encoded with LogArgs (see LogArgs.h)
+};
+
+struct FLogRecordHeader {
+    uint32_t size;              // Total bytes including header and padding (multiple of 8)
+    ELogRecordType type;
+    uint8_t verbosity;          // ELogVerbosity
+    uint16_t reserved;
+    uint32_t payloadLength;
+    uint32_t threadIndex;       // Index of the producing thread (stable for its lifetime)
+    int64_t timestamp;          // FLog::GetTimestamp() when the record was captured
+    const char* category;       // Static string from DEFINE_LOG_CATEGORY_STATIC
+    const char* format;         // Deferred records: format string literal of the call site
+};
+
+constexpr size_t LOG_RECORD_ALIGNMENT = 8;
+
+class FLogRingBuffer {
+public:
+    // Capacity is rounded up to a power of two
+    explicit FLogRingBuffer(size_t requestedCapacity)
+        : capacity(RoundUpToPowerOfTwo(requestedCapacity))
+        , mask(capacity - 1)
+        , buffer(new uint8_t[capacity])
+    {
+    }
+
+    FLogRingBuffer(const FLogRingBuffer&) = delete;
+    FLogRingBuffer& operator=(const FLogRingBuffer&) = delete;
+
+    static size_t AlignRecordSize(size_t size) {
+        return (size + LOG_RECORD_ALIGNMENT - 1) & ~(LOG_RECORD_ALIGNMENT - 1);
+    }
+
+    // --- Producer ---
+
+    // Reserve 'size' contiguous bytes (already aligned). Returns nullptr if the ring is
+    // full; the caller then retries after the consumer made room.
+    uint8_t* BeginWrite(size_t size) {
+        if (size > capacity / 2) {
+            return nullptr;
+        }
+
+        size_t head = writeHead;
+        size_t tail = readTail.load(std::memory_order_acquire);
+        size_t offset = head & mask;
+        size_t bytesToEnd = capacity - offset;
+        size_t skip = bytesToEnd < size ? bytesToEnd : 0;
+
+        if (head + skip + size - tail > capacity) {
+            return nullptr;
+        }
+
+        if (skip > 0) {
+            if (skip >= sizeof(FLogRecordHeader)) {
+                FLogRecordHeader* padding = reinterpret_cast<FLogRecordHeader*>(buffer.get() + offset);
+                padding->size = static_cast<uint32_t>(skip);
+                padding->type = ELogRecordType::Padding;
+            }
+            head += skip;
+            writeHead = head;
+        }
+
+        return buffer.get() + (head & mask);
+    }
+
+    // Publish the bytes reserved by BeginWrite
+    void CommitWrite(size_t size) {
+        writeHead += size;
+        publishedHead.store(writeHead, std::memory_order_release);
+    }
+
+    // Bytes not yet consumed (approximate from the producer side)
+    size_t UsedBytes() const {
+        return publishedHead.load(std::memory_order_relaxed) - readTail.load(std::memory_order_relaxed);
+    }
+
+    size_t Capacity() const { return capacity; }
+
+    // --- Consumer ---
+
+    // Visit every record published so far with visitor(const FLogRecordHeader&, const char* payload)
+    // and release their space. Returns the number of records visited.
+    template<typename VisitorType>
+    size_t Consume(VisitorType&& visitor) {
+        size_t tail = readTail.load(std::memory_order_relaxed);
+        const size_t head = publishedHead.load(std::memory_order_acquire);
+        size_t recordCount = 0;
+
+        while (tail < head) {
+            size_t offset = tail & mask;
+            size_t bytesToEnd = capacity - offset;
+            if (bytesToEnd < sizeof(FLogRecordHeader)) {
+                tail += bytesToEnd;
+                continue;
+            }
+
+            const FLogRecordHeader* header = reinterpret_cast<const FLogRecordHeader*>(buffer.get() + offset);
+            if (header->type != ELogRecordType::Padding) {
+                visitor(*header, reinterpret_cast<const char*>(header + 1));
+                recordCount++;
+            }
+            tail += header->size;
+        }
+
+        readTail.store(tail, std::memory_order_release);
+        return recordCount;
+    }
+
+    bool IsEmpty() const {
+        return publishedHead.load(std::memory_order_acquire) == readTail.load(std::memory_order_acquire);
+    }
+
+private:
+    static size_t RoundUpToPowerOfTwo(size_t value) {
+        size_t result = 1024;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<uint8_t[]> buffer;
+
+    // Producer-owned write position (includes reserved but unpublished bytes)
+    alignas(64) size_t writeHead = 0;
+    std::atomic<size_t> publishedHead{0};
+
+    // Consumer-owned read position
+    alignas(64) std::atomic<size_t> readTail{0};
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+// Log verbosity levels (similar to UE_LOG verbosity)
+enum class ELogVerbosity : uint8_t {
+    NoLogging = 0,
+    Fatal,      // Always logs, crashes the game
+    Error,      // Error level
+    Warning,    // Warning level
+    Display,    // Display level
+    Log,        // Log level
+    Verbose,    // Verbose level
+    VeryVerbose // Very verbose level
+};
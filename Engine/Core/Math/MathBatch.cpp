@@ -0,0 +1,434 @@
+#include "MathBatch.h"
+#include "VectorRegister.h"
+#include <algorithm>
+
+// SoA <-> AoS reads and writes Vector3 arrays as packed floats
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be three packed floats");
+
+namespace {
+    // out = rows 0..2 of m applied to (x, y, z, bTranslate ? 1 : 0), summed in the
+    // same order as Matrix4x4::TransformPoint/TransformVector
+    template<bool bTranslate>
+    void TransformArrays(const float* m, const float* xs, const float* ys, const float* zs,
+                         float* outXs, float* outYs, float* outZs, size_t count) {
+        size_t i = 0;
+
+#if MATH_SIMD_AVX
+        {
+            const __m256 m0 = _mm256_set1_ps(m[0]), m4 = _mm256_set1_ps(m[4]), m8 = _mm256_set1_ps(m[8]);
+            const __m256 m1 = _mm256_set1_ps(m[1]), m5 = _mm256_set1_ps(m[5]), m9 = _mm256_set1_ps(m[9]);
+            const __m256 m2 = _mm256_set1_ps(m[2]), m6 = _mm256_set1_ps(m[6]), m10 = _mm256_set1_ps(m[10]);
+            const __m256 m12 = _mm256_set1_ps(m[12]), m13 = _mm256_set1_ps(m[13]), m14 = _mm256_set1_ps(m[14]);
+            for (; i + 8 <= count; i += 8) {
+                const __m256 x = _mm256_loadu_ps(xs + i);
+                const __m256 y = _mm256_loadu_ps(ys + i);
+                const __m256 z = _mm256_loadu_ps(zs + i);
+                __m256 outX = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, x), _mm256_mul_ps(m4, y)),
+                                            _mm256_mul_ps(m8, z));
+                __m256 outY = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, x), _mm256_mul_ps(m5, y)),
+                                            _mm256_mul_ps(m9, z));
+                __m256 outZ = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, x), _mm256_mul_ps(m6, y)),
+                                            _mm256_mul_ps(m10, z));
+                if (bTranslate) {
+                    outX = _mm256_add_ps(outX, m12);
+                    outY = _mm256_add_ps(outY, m13);
+                    outZ = _mm256_add_ps(outZ, m14);
+                }
+                _mm256_storeu_ps(outXs + i, outX);
+                _mm256_storeu_ps(outYs + i, outY);
+                _mm256_storeu_ps(outZs + i, outZ);
+            }
+        }
+#endif
+
+#if MATH_SIMD_ENABLED
+        {
+            const VectorRegister m0 = VectorSplat(m[0]), m4 = VectorSplat(m[4]), m8 = VectorSplat(m[8]);
+            const VectorRegister m1 = VectorSplat(m[1]), m5 = VectorSplat(m[5]), m9 = VectorSplat(m[9]);
+            const VectorRegister m2 = VectorSplat(m[2]), m6 = VectorSplat(m[6]), m10 = VectorSplat(m[10]);
+            const VectorRegister m12 = VectorSplat(m[12]), m13 = VectorSplat(m[13]), m14 = VectorSplat(m[14]);
+            for (; i + 4 <= count; i += 4) {
+                const VectorRegister x = VectorLoad(xs + i);
+                const VectorRegister y = VectorLoad(ys + i);
+                const VectorRegister z = VectorLoad(zs + i);
+                VectorRegister outX = VectorMultiplyAdd(m8, z, VectorMultiplyAdd(m4, y, VectorMultiply(m0, x)));
+                VectorRegister outY = VectorMultiplyAdd(m9, z, VectorMultiplyAdd(m5, y, VectorMultiply(m1, x)));
+                VectorRegister outZ = VectorMultiplyAdd(m10, z, VectorMultiplyAdd(m6, y, VectorMultiply(m2, x)));
+                if (bTranslate) {
+                    outX = VectorAdd(outX, m12);
+                    outY = VectorAdd(outY, m13);
+                    outZ = VectorAdd(outZ, m14);
+                }
+                VectorStore(outX, outXs + i);
+                VectorStore(outY, outYs + i);
+                VectorStore(outZ, outZs + i);
+            }
+        }
+#endif
+
+        for (; i < count; i++) {
+            const float x = xs[i];
+            const float y = ys[i];
+            const float z = zs[i];
+            if (bTranslate) {
+                outXs[i] = m[0] * x + m[4] * y + m[8] * z + m[12];
+                outYs[i] = m[1] * x + m[5] * y + m[9] * z + m[13];
+                outZs[i] = m[2] * x + m[6] * y + m[10] * z + m[14];
+            } else {
+                outXs[i] = m[0] * x + m[4] * y + m[8] * z;
+                outYs[i] = m[1] * x + m[5] * y + m[9] * z;
+                outZs[i] = m[2] * x + m[6] * y + m[10] * z;
+            }
+        }
+    }
+
+    // Quaternion kernels run on groups of four: one register per component, lane i
+    // is element i of the group
+    struct FQuaternionLanes {
+        VectorRegister x, y, z, w;
+    };
+
+    struct FVectorLanes {
+        VectorRegister x, y, z;
+    };
+
+    // laneCount < 4 only for the last group: missing quaternions are identity
+    inline FQuaternionLanes LoadQuaternions(const Quaternion* source, size_t laneCount) {
+        Quaternion padded[4];
+        if (laneCount < 4) {
+            std::copy(source, source + laneCount, padded);
+            source = padded;
+        }
+        FQuaternionLanes q = {VectorLoad(&source[0].x), VectorLoad(&source[1].x), VectorLoad(&source[2].x),
+                              VectorLoad(&source[3].x)};
+        VectorTranspose(q.x, q.y, q.z, q.w);
+        return q;
+    }
+
+    inline void StoreQuaternions(FQuaternionLanes q, Quaternion* destination, size_t laneCount) {
+        VectorTranspose(q.x, q.y, q.z, q.w);
+        Quaternion padded[4];
+        Quaternion* target = laneCount < 4 ? padded : destination;
+        VectorStore(q.x, &target[0].x);
+        VectorStore(q.y, &target[1].x);
+        VectorStore(q.z, &target[2].x);
+        VectorStore(q.w, &target[3].x);
+        if (laneCount < 4) {
+            std::copy(padded, padded + laneCount, destination);
+        }
+    }
+
+    inline VectorRegister LoadLanes(const float* source, size_t laneCount) {
+        if (laneCount < 4) {
+            float padded[4] = {};
+            std::copy(source, source + laneCount, padded);
+            return VectorLoad(padded);
+        }
+        return VectorLoad(source);
+    }
+
+    inline void StoreLanes(VectorRegister value, float* destination, size_t laneCount) {
+        if (laneCount < 4) {
+            float padded[4];
+            VectorStore(value, padded);
+            std::copy(padded, padded + laneCount, destination);
+        } else {
+            VectorStore(value, destination);
+        }
+    }
+
+    // Same sum order as Quaternion::Dot (VectorDot4): (x + z) + (y + w)
+    inline VectorRegister Dot(const FQuaternionLanes& a, const FQuaternionLanes& b) {
+        return VectorAdd(VectorMultiplyAdd(a.z, b.z, VectorMultiply(a.x, b.x)),
+                         VectorMultiplyAdd(a.w, b.w, VectorMultiply(a.y, b.y)));
+    }
+
+    // a.xyz x b, same operations as VectorCross
+    inline FVectorLanes Cross(const FQuaternionLanes& a, const FVectorLanes& b) {
+        return {VectorSubtract(VectorMultiply(a.y, b.z), VectorMultiply(a.z, b.y)),
+                VectorSubtract(VectorMultiply(a.z, b.x), VectorMultiply(a.x, b.z)),
+                VectorSubtract(VectorMultiply(a.x, b.y), VectorMultiply(a.y, b.x))};
+    }
+
+    // Quaternion::Normalized per lane
+    inline FQuaternionLanes Normalize(const FQuaternionLanes& q) {
+        const VectorRegister length = VectorSqrt(Dot(q, q));
+        const VectorRegister valid = VectorCompareGT(length, VectorSplat(0.00001f));
+        return {VectorSelect(valid, VectorDivide(q.x, length), VectorZero()),
+                VectorSelect(valid, VectorDivide(q.y, length), VectorZero()),
+                VectorSelect(valid, VectorDivide(q.z, length), VectorZero()),
+                VectorSelect(valid, VectorDivide(q.w, length), VectorSplat(1.0f))};
+    }
+
+    // -1 where a . b < 0 (b on the other hemisphere), +1 elsewhere
+    inline VectorRegister ShortestPathSign(VectorRegister dot) {
+        return VectorSelect(VectorCompareLT(dot, VectorZero()), VectorSplat(-1.0f), VectorSplat(1.0f));
+    }
+
+    inline FQuaternionLanes Nlerp(const FQuaternionLanes& a, const FQuaternionLanes& b, VectorRegister t) {
+        // a + (b - a) * t as in Quaternion::Slerp, with b already flipped
+        const VectorRegister sign = ShortestPathSign(Dot(a, b));
+        return Normalize({VectorMultiplyAdd(VectorSubtract(VectorMultiply(b.x, sign), a.x), t, a.x),
+                          VectorMultiplyAdd(VectorSubtract(VectorMultiply(b.y, sign), a.y), t, a.y),
+                          VectorMultiplyAdd(VectorSubtract(VectorMultiply(b.z, sign), a.z), t, a.z),
+                          VectorMultiplyAdd(VectorSubtract(VectorMultiply(b.w, sign), a.w), t, a.w)});
+    }
+
+    // sin(s phi) / sin(phi) as a series in (cos(phi) - 1) (D. Eberly, "A Fast and
+    // Accurate Algorithm for Computing SLERP"): term i is term i - 1 times
+    // (s^2 - i^2) / (i (2i + 1)) (cos(phi) - 1). Truncated after SLERP_TERMS terms,
+    // with the last factor scaled by 1 + SLERP_MU to absorb most of the truncation error.
+    constexpr int SLERP_TERMS = 5;
+    constexpr float SLERP_MU = 0.14195592f;
+    // (s^2 - i^2) / (i (2i + 1)) = U[i] s^2 - V[i]
+    constexpr float SLERP_U[SLERP_TERMS] = {1.0f / 3.0f, 1.0f / 10.0f, 1.0f / 21.0f, 1.0f / 36.0f,
+                                            (1.0f + SLERP_MU) / 55.0f};
+    constexpr float SLERP_V[SLERP_TERMS] = {1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f,
+                                            (1.0f + SLERP_MU) * 5.0f / 11.0f};
+
+    inline VectorRegister SlerpSeries(VectorRegister s, VectorRegister cosPhiMinusOne) {
+        const VectorRegister sSquared = VectorMultiply(s, s);
+        const VectorRegister one = VectorSplat(1.0f);
+        VectorRegister sum = one;
+        for (int i = SLERP_TERMS - 1; i >= 0; i--) {
+            const VectorRegister factor = VectorSubtract(VectorMultiply(VectorSplat(SLERP_U[i]), sSquared),
+                                                         VectorSplat(SLERP_V[i]));
+            sum = VectorMultiplyAdd(VectorMultiply(sum, factor), cosPhiMinusOne, one);
+        }
+        return VectorMultiply(s, sum);
+    }
+
+    inline FQuaternionLanes Slerp(const FQuaternionLanes& a, const FQuaternionLanes& b, VectorRegister t) {
+        const VectorRegister one = VectorSplat(1.0f);
+        const VectorRegister half = VectorSplat(0.5f);
+        const VectorRegister dot = Dot(a, b);
+
+        // The series converges slowly up to theta = 90 degrees (cos(theta) = 0), so it
+        // runs on phi = theta / 2: sin(t theta) / sin(theta) = f(2t, phi) / (2 cos(phi)),
+        // with cos(phi) = sqrt((1 + cos(theta)) / 2) >= 0.707
+        const VectorRegister cosTheta = VectorMin(VectorAbs(dot), one);
+        const VectorRegister cosPhi = VectorSqrt(VectorMultiply(VectorAdd(cosTheta, one), half));
+        const VectorRegister cosPhiMinusOne = VectorSubtract(cosPhi, one);
+        const VectorRegister inverseTwoCosPhi = VectorDivide(half, cosPhi);
+
+        const VectorRegister oneMinusT = VectorSubtract(one, t);
+        const VectorRegister weightA = VectorMultiply(SlerpSeries(VectorAdd(oneMinusT, oneMinusT), cosPhiMinusOne),
+                                                      inverseTwoCosPhi);
+        // The shortest path flip of b goes into its weight
+        const VectorRegister weightB = VectorMultiply(VectorMultiply(SlerpSeries(VectorAdd(t, t), cosPhiMinusOne),
+                                                                     inverseTwoCosPhi),
+                                                      ShortestPathSign(dot));
+        return {VectorMultiplyAdd(b.x, weightB, VectorMultiply(a.x, weightA)),
+                VectorMultiplyAdd(b.y, weightB, VectorMultiply(a.y, weightA)),
+                VectorMultiplyAdd(b.z, weightB, VectorMultiply(a.z, weightA)),
+                VectorMultiplyAdd(b.w, weightB, VectorMultiply(a.w, weightA))};
+    }
+}
+
+void MathBatch::AoSToSoA(const Vector3* points, float* xs, float* ys, float* zs, size_t count) {
+    const float* source = reinterpret_cast<const float*>(points);
+    size_t i = 0;
+
+#if MATH_SIMD_ENABLED
+    // 4 points = 3 registers: (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+    for (; i + 4 <= count; i += 4) {
+        const VectorRegister v0 = VectorLoad(source + i * 3);
+        const VectorRegister v1 = VectorLoad(source + i * 3 + 4);
+        const VectorRegister v2 = VectorLoad(source + i * 3 + 8);
+        const VectorRegister x = VectorShuffle<0, 3, 0, 2>(v0, VectorShuffle<2, 2, 1, 1>(v1, v2));
+        const VectorRegister y = VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 0, 0>(v0, v1),
+                                                           VectorShuffle<3, 3, 2, 2>(v1, v2));
+        const VectorRegister z = VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 1, 1>(v0, v1),
+                                                           VectorShuffle<0, 0, 3, 3>(v2, v2));
+        VectorStore(x, xs + i);
+        VectorStore(y, ys + i);
+        VectorStore(z, zs + i);
+    }
+#endif
+
+    for (; i < count; i++) {
+        xs[i] = source[i * 3];
+        ys[i] = source[i * 3 + 1];
+        zs[i] = source[i * 3 + 2];
+    }
+}
+
+void MathBatch::SoAToAoS(const float* xs, const float* ys, const float* zs, Vector3* points, size_t count) {
+    float* destination = reinterpret_cast<float*>(points);
+    size_t i = 0;
+
+#if MATH_SIMD_ENABLED
+    for (; i + 4 <= count; i += 4) {
+        const VectorRegister x = VectorLoad(xs + i);
+        const VectorRegister y = VectorLoad(ys + i);
+        const VectorRegister z = VectorLoad(zs + i);
+        const VectorRegister v0 = VectorShuffle<0, 2, 0, 2>(VectorShuffle<0, 0, 0, 0>(x, y),
+                                                            VectorShuffle<0, 0, 1, 1>(z, x));
+        const VectorRegister v1 = VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 1, 1>(y, z),
+                                                            VectorShuffle<2, 2, 2, 2>(x, y));
+        const VectorRegister v2 = VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 3, 3>(z, x),
+                                                            VectorShuffle<3, 3, 3, 3>(y, z));
+        VectorStore(v0, destination + i * 3);
+        VectorStore(v1, destination + i * 3 + 4);
+        VectorStore(v2, destination + i * 3 + 8);
+    }
+#endif
+
+    for (; i < count; i++) {
+        destination[i * 3] = xs[i];
+        destination[i * 3 + 1] = ys[i];
+        destination[i * 3 + 2] = zs[i];
+    }
+}
+
+void MathBatch::TransformPoints(const Matrix4x4& matrix, const float* xs, const float* ys, const float* zs,
+                                float* outXs, float* outYs, float* outZs, size_t count) {
+    TransformArrays<true>(matrix.m, xs, ys, zs, outXs, outYs, outZs, count);
+}
+
+void MathBatch::TransformPoints(const Transform& transform, const float* xs, const float* ys, const float* zs,
+                                float* outXs, float* outYs, float* outZs, size_t count) {
+    const Matrix4x4 matrix = transform.ToMatrix();
+    TransformArrays<true>(matrix.m, xs, ys, zs, outXs, outYs, outZs, count);
+}
+
+void MathBatch::TransformVectors(const Matrix4x4& matrix, const float* xs, const float* ys, const float* zs,
+                                 float* outXs, float* outYs, float* outZs, size_t count) {
+    TransformArrays<false>(matrix.m, xs, ys, zs, outXs, outYs, outZs, count);
+}
+
+void MathBatch::MultiplyMatrices(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        MatrixKernels::Multiply(a[i].m, b[i].m, out[i].m);
+    }
+}
+
+void MathBatch::MultiplyMatrices(const Matrix4x4& parent, const Matrix4x4* children, Matrix4x4* out, size_t count) {
+#if MATH_SIMD_ENABLED
+    // The parent columns stay in registers for the whole array (same sums as MatrixKernels::Multiply)
+    const VectorRegister a0 = VectorLoad(parent.m);
+    const VectorRegister a1 = VectorLoad(parent.m + 4);
+    const VectorRegister a2 = VectorLoad(parent.m + 8);
+    const VectorRegister a3 = VectorLoad(parent.m + 12);
+    for (size_t i = 0; i < count; i++) {
+        const float* b = children[i].m;
+        const VectorRegister bColumns[4] = {VectorLoad(b), VectorLoad(b + 4), VectorLoad(b + 8), VectorLoad(b + 12)};
+        for (int col = 0; col < 4; col++) {
+            VectorRegister result = VectorMultiply(a0, VectorReplicate<0>(bColumns[col]));
+            result = VectorAdd(result, VectorMultiply(a1, VectorReplicate<1>(bColumns[col])));
+            result = VectorAdd(result, VectorMultiply(a2, VectorReplicate<2>(bColumns[col])));
+            result = VectorAdd(result, VectorMultiply(a3, VectorReplicate<3>(bColumns[col])));
+            VectorStore(result, out[i].m + col * 4);
+        }
+    }
+#else
+    for (size_t i = 0; i < count; i++) {
+        MatrixKernels::Multiply(parent.m, children[i].m, out[i].m);
+    }
+#endif
+}
+
+void MathBatch::NormalizeQuaternions(const Quaternion* quaternions, Quaternion* out, size_t count) {
+    for (size_t i = 0; i < count; i += 4) {
+        const size_t laneCount = std::min<size_t>(count - i, 4);
+        StoreQuaternions(Normalize(LoadQuaternions(quaternions + i, laneCount)), out + i, laneCount);
+    }
+}
+
+void MathBatch::NlerpQuaternions(const Quaternion* a, const Quaternion* b, float t, Quaternion* out, size_t count) {
+    const VectorRegister tLanes = VectorSplat(t);
+    for (size_t i = 0; i < count; i += 4) {
+        const size_t laneCount = std::min<size_t>(count - i, 4);
+        StoreQuaternions(Nlerp(LoadQuaternions(a + i, laneCount), LoadQuaternions(b + i, laneCount), tLanes),
+                         out + i, laneCount);
+    }
+}
+
+void MathBatch::NlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* ts, Quaternion* out,
+                                 size_t count) {
+    for (size_t i = 0; i < count; i += 4) {
+        const size_t laneCount = std::min<size_t>(count - i, 4);
+        StoreQuaternions(Nlerp(LoadQuaternions(a + i, laneCount), LoadQuaternions(b + i, laneCount),
+                               LoadLanes(ts + i, laneCount)),
+                         out + i, laneCount);
+    }
+}
+
+void MathBatch::SlerpQuaternions(const Quaternion* a, const Quaternion* b, float t, Quaternion* out, size_t count) {
+    const VectorRegister tLanes = VectorSplat(t);
+    for (size_t i = 0; i < count; i += 4) {
+        const size_t laneCount = std::min<size_t>(count - i, 4);
+        StoreQuaternions(Slerp(LoadQuaternions(a + i, laneCount), LoadQuaternions(b + i, laneCount), tLanes),
+                         out + i, laneCount);
+    }
+}
+
+void MathBatch::SlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* ts, Quaternion* out,
+                                 size_t count) {
+    for (size_t i = 0; i < count; i += 4) {
+        const size_t laneCount = std::min<size_t>(count - i, 4);
+        StoreQuaternions(Slerp(LoadQuaternions(a + i, laneCount), LoadQuaternions(b + i, laneCount),
+                               LoadLanes(ts + i, laneCount)),
+                         out + i, laneCount);
+    }
+}
+
+void MathBatch::RotateVectors(const Quaternion& rotation, const float* xs, const float* ys, const float* zs,
+                              float* outXs, float* outYs, float* outZs, size_t count) {
+    const Matrix4x4 matrix = rotation.ToMatrix();
+    TransformArrays<false>(matrix.m, xs, ys, zs, outXs, outYs, outZs, count);
+}
+
+void MathBatch::RotateVectors(const Quaternion* rotations, const float* xs, const float* ys, const float* zs,
+                              float* outXs, float* outYs, float* outZs, size_t count) {
+    for (size_t i = 0; i < count; i += 4) {
+        const size_t laneCount = std::min<size_t>(count - i, 4);
+        const FQuaternionLanes q = LoadQuaternions(rotations + i, laneCount);
+        const FVectorLanes v = {LoadLanes(xs + i, laneCount), LoadLanes(ys + i, laneCount),
+                                LoadLanes(zs + i, laneCount)};
+
+        // Quaternion::RotateVector: t = 2 (q.xyz x v), v + w t + q.xyz x t
+        const FVectorLanes cross = Cross(q, v);
+        const FVectorLanes t = {VectorAdd(cross.x, cross.x), VectorAdd(cross.y, cross.y),
+                                VectorAdd(cross.z, cross.z)};
+        const FVectorLanes crossT = Cross(q, t);
+        StoreLanes(VectorAdd(VectorMultiplyAdd(q.w, t.x, v.x), crossT.x), outXs + i, laneCount);
+        StoreLanes(VectorAdd(VectorMultiplyAdd(q.w, t.y, v.y), crossT.y), outYs + i, laneCount);
+        StoreLanes(VectorAdd(VectorMultiplyAdd(q.w, t.z, v.z), crossT.z), outZs + i, laneCount);
+    }
+}
+
+void MathBatch::QuaternionsToMatrices(const Quaternion* rotations, Matrix4x4* out, size_t count) {
+    const VectorRegister one = VectorSplat(1.0f);
+    const VectorRegister lastColumn = VectorSet(0.0f, 0.0f, 0.0f, 1.0f);
+    for (size_t i = 0; i < count; i += 4) {
+        const size_t laneCount = std::min<size_t>(count - i, 4);
+        const FQuaternionLanes q = LoadQuaternions(rotations + i, laneCount);
+        const VectorRegister x2 = VectorAdd(q.x, q.x);
+        const VectorRegister y2 = VectorAdd(q.y, q.y);
+        const VectorRegister z2 = VectorAdd(q.z, q.z);
+
+        // Rows 0..3 of columns 0..2, same sums as Quaternion::ToMatrix. The transpose
+        // turns them into one column per matrix.
+        VectorRegister columns[3][4] = {
+            {VectorSubtract(VectorSubtract(one, VectorMultiply(q.y, y2)), VectorMultiply(q.z, z2)),
+             VectorAdd(VectorMultiply(q.x, y2), VectorMultiply(q.w, z2)),
+             VectorSubtract(VectorMultiply(q.x, z2), VectorMultiply(q.w, y2)), VectorZero()},
+            {VectorSubtract(VectorMultiply(q.x, y2), VectorMultiply(q.w, z2)),
+             VectorSubtract(VectorSubtract(one, VectorMultiply(q.x, x2)), VectorMultiply(q.z, z2)),
+             VectorAdd(VectorMultiply(q.y, z2), VectorMultiply(q.w, x2)), VectorZero()},
+            {VectorAdd(VectorMultiply(q.x, z2), VectorMultiply(q.w, y2)),
+             VectorSubtract(VectorMultiply(q.y, z2), VectorMultiply(q.w, x2)),
+             VectorSubtract(VectorSubtract(one, VectorMultiply(q.x, x2)), VectorMultiply(q.y, y2)), VectorZero()}};
+
+        for (int col = 0; col < 3; col++) {
+            VectorTranspose(columns[col][0], columns[col][1], columns[col][2], columns[col][3]);
+            for (size_t lane = 0; lane < laneCount; lane++) {
+                VectorStore(columns[col][lane], out[i + lane].m + col * 4);
+            }
+        }
+        for (size_t lane = 0; lane < laneCount; lane++) {
+            VectorStore(lastColumn, out[i + lane].m + 12);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Vector.h"
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "Transform.h"
+#include <cstddef>
+
+// ============================================================================
+// MathBatch - Transforms over arrays (structure of arrays)
+// ============================================================================
+//
+// Batch versions of the per-point/per-matrix operations for vertex arrays,
+// bounding volumes, culling and picking. Points are passed as separate x, y and z
+// arrays (SoA) so each SIMD lane handles one point: 8 points per iteration with
+// AVX (ENGINE_MATH_AVX2=ON in CMake), 4 with SSE/NEON, and a scalar loop for the
+// remainder.
+//
+// Every lane does the same operations, in the same order, as the scalar
+// Matrix4x4 code, so the results are bit-identical to Matrix4x4::TransformPoint
+// and operator*. That relies on the math sources being built with
+// -ffp-contract=off (see CMakeLists.txt): an FMA-contracted build rounds differently.
+//
+// Quaternion arrays stay AoS (Quaternion is four packed floats): groups of four
+// are transposed into one register per component, and the last partial group is
+// padded with identity quaternions, so every element goes through the same code.
+// Except for Slerp they match the single-quaternion operations bit for bit.
+//
+// Outputs may be the inputs (in place), but must not partially overlap them.
+
+namespace MathBatch {
+    // AoS <-> SoA conversion
+    void AoSToSoA(const Vector3* points, float* xs, float* ys, float* zs, size_t count);
+    void SoAToAoS(const float* xs, const float* ys, const float* zs, Vector3* points, size_t count);
+
+    // out = matrix * (x, y, z, 1). Affine matrices only (last row 0, 0, 0, 1):
+    // no perspective divide.
+    void TransformPoints(const Matrix4x4& matrix, const float* xs, const float* ys, const float* zs,
+                         float* outXs, float* outYs, float* outZs, size_t count);
+
+    // Through transform.ToMatrix() (rounds differently from Transform::TransformPoint)
+    void TransformPoints(const Transform& transform, const float* xs, const float* ys, const float* zs,
+                         float* outXs, float* outYs, float* outZs, size_t count);
+
+    // out = matrix * (x, y, z, 0): directions and offsets, no translation
+    void TransformVectors(const Matrix4x4& matrix, const float* xs, const float* ys, const float* zs,
+                          float* outXs, float* outYs, float* outZs, size_t count);
+
+    // out[i] = a[i] * b[i]
+    void MultiplyMatrices(const Matrix4x4* a, const Matrix4x4* b, Matrix4x4* out, size_t count);
+
+    // out[i] = parent * children[i] (e.g. local to world for every child of a node)
+    void MultiplyMatrices(const Matrix4x4& parent, const Matrix4x4* children, Matrix4x4* out, size_t count);
+
+    // out[i] = quaternions[i].Normalized() (identity for zero-length quaternions)
+    void NormalizeQuaternions(const Quaternion* quaternions, Quaternion* out, size_t count);
+
+    // Normalized lerp along the shortest path, as the small-angle branch of
+    // Quaternion::Slerp. Either one t for every pair or ts[i] per pair.
+    void NlerpQuaternions(const Quaternion* a, const Quaternion* b, float t, Quaternion* out, size_t count);
+    void NlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* ts, Quaternion* out,
+                          size_t count);
+
+    // Constant angular velocity interpolation along the shortest path, for unit
+    // quaternions. The sin(t theta) / sin(theta) weights come from a polynomial
+    // (no acos/sin) with an absolute error below 1e-7 before float rounding; the
+    // result is not renormalized.
+    void SlerpQuaternions(const Quaternion* a, const Quaternion* b, float t, Quaternion* out, size_t count);
+    void SlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* ts, Quaternion* out,
+                          size_t count);
+
+    // One rotation for every vector, through rotation.ToMatrix() (TransformVectors)
+    void RotateVectors(const Quaternion& rotation, const float* xs, const float* ys, const float* zs,
+                       float* outXs, float* outYs, float* outZs, size_t count);
+
+    // out[i] = rotations[i].RotateVector(vector i)
+    void RotateVectors(const Quaternion* rotations, const float* xs, const float* ys, const float* zs,
+                       float* outXs, float* outYs, float* outZs, size_t count);
+
+    // out[i] = rotations[i].ToMatrix()
+    void QuaternionsToMatrices(const Quaternion* rotations, Matrix4x4* out, size_t count);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+// ============================================================================
+// MathSIMD - Compile-time SIMD backend selection for the math library
+// ============================================================================
+//
+// SSE on x86/x64 (AVX is only used where 8 lanes help, when the compiler targets
+// it), NEON on ARM, plain scalar code otherwise. VectorRegister.h builds the
+// 4-float register type and its operations on top of this.
+
+// Set to 0 to build the math library with the scalar kernels only
+#ifndef ENGINE_MATH_SIMD
+#define ENGINE_MATH_SIMD 1
+#endif
+
+#if ENGINE_MATH_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SIMD_SSE 1
+#include <emmintrin.h>
+#if defined(__AVX__)
+#define MATH_SIMD_AVX 1
+#include <immintrin.h>
+#endif
+#elif ENGINE_MATH_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define MATH_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifndef MATH_SIMD_SSE
+#define MATH_SIMD_SSE 0
+#endif
+#ifndef MATH_SIMD_AVX
+#define MATH_SIMD_AVX 0
+#endif
+#ifndef MATH_SIMD_NEON
+#define MATH_SIMD_NEON 0
+#endif
+
+#define MATH_SIMD_ENABLED (MATH_SIMD_SSE || MATH_SIMD_NEON)
+
+#if MATH_SIMD_AVX
+#define MATH_SIMD_BACKEND_NAME "AVX"
+#elif MATH_SIMD_SSE
+#define MATH_SIMD_BACKEND_NAME "SSE"
+#elif MATH_SIMD_NEON
+#define MATH_SIMD_BACKEND_NAME "NEON"
+#else
+#define MATH_SIMD_BACKEND_NAME "Scalar"
+#endif
@@ -1,6 +1,30 @@
 #include "Matrix.h"
+#include "VectorRegister.h"
 #include "Quaternion.h"
 #include <algorithm>
+#include <cstring>
+
+namespace {
+    // Below this |determinant| a matrix is treated as singular
+    constexpr float SINGULAR_DETERMINANT = 0.0001f;
+
+    // MatrixKernels::TransformVector4 for a vector held in registers: packing the
+    // components through a float[4] (four 4-byte stores, one 16-byte load) stalls
+    // store forwarding and costs more than the transform itself
+    inline void TransformVectorRegister(const float* m, float x, float y, float z, float w, float* out) {
+#if MATH_SIMD_ENABLED
+        const VectorRegister vector = VectorSet(x, y, z, w);
+        VectorRegister result = VectorMultiply(VectorLoad(m), VectorReplicate<0>(vector));
+        result = VectorAdd(result, VectorMultiply(VectorLoad(m + 4), VectorReplicate<1>(vector)));
+        result = VectorAdd(result, VectorMultiply(VectorLoad(m + 8), VectorReplicate<2>(vector)));
+        result = VectorAdd(result, VectorMultiply(VectorLoad(m + 12), VectorReplicate<3>(vector)));
+        VectorStore(result, out);
+#else
+        const float input[4] = {x, y, z, w};
+        MatrixKernels::TransformVector4Scalar(m, input, out);
+#endif
+    }
+}
 
 // ============================================================================
 // Matrix4x4 Implementation
@@ -58,7 +82,13 @@ Matrix4x4 Matrix4x4::Scale(const Vector3& scale) {
 }
 
 Matrix4x4 Matrix4x4::TRS(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) {
-    return Translation(translation) * Rotation(rotation) * Scale(scale);
+    // T * R * S without the two full products: scaled rotation columns plus the translation
+    Matrix4x4 result = rotation.ToMatrix();
+    VectorStore(VectorMultiply(VectorLoad(result.m), VectorSplat(scale.x)), result.m);
+    VectorStore(VectorMultiply(VectorLoad(result.m + 4), VectorSplat(scale.y)), result.m + 4);
+    VectorStore(VectorMultiply(VectorLoad(result.m + 8), VectorSplat(scale.z)), result.m + 8);
+    VectorStore(VectorLoad(translation, 1.0f), result.m + 12);
+    return result;
 }
 
 Matrix4x4 Matrix4x4::LookAt(const Vector3& eye, const Vector3& target, const Vector3& up) {
@@ -136,10 +166,16 @@ Vector3 Matrix4x4::GetTranslation() const {
 }
 
 Vector3 Matrix4x4::GetScale() const {
-    Vector3 x(m[0], m[1], m[2]);
-    Vector3 y(m[4], m[5], m[6]);
-    Vector3 z(m[8], m[9], m[10]);
-    return Vector3(x.Size(), y.Size(), z.Size());
+    // Squared columns transposed so one sqrt gives the three lengths
+    VectorRegister x = VectorLoad(m);
+    VectorRegister y = VectorLoad(m + 4);
+    VectorRegister z = VectorLoad(m + 8);
+    x = VectorMultiply(x, x);
+    y = VectorMultiply(y, y);
+    z = VectorMultiply(z, z);
+    VectorRegister w = VectorZero();
+    VectorTranspose(x, y, z, w);
+    return VectorToVector3(VectorSqrt(VectorAdd(VectorAdd(x, y), z)));
 }
 
 Quaternion Matrix4x4::GetRotation() const {
@@ -162,59 +198,47 @@ Quaternion Matrix4x4::GetRotation() const {
 
 Matrix4x4 Matrix4x4::operator+(const Matrix4x4& other) const {
     Matrix4x4 result;
-    for (int i = 0; i < 16; i++) {
-        result.m[i] = m[i] + other.m[i];
+    for (int i = 0; i < 16; i += 4) {
+        VectorStore(VectorAdd(VectorLoad(m + i), VectorLoad(other.m + i)), result.m + i);
     }
     return result;
 }
 
 Matrix4x4 Matrix4x4::operator-(const Matrix4x4& other) const {
     Matrix4x4 result;
-    for (int i = 0; i < 16; i++) {
-        result.m[i] = m[i] - other.m[i];
+    for (int i = 0; i < 16; i += 4) {
+        VectorStore(VectorSubtract(VectorLoad(m + i), VectorLoad(other.m + i)), result.m + i);
     }
     return result;
 }
 
 Matrix4x4 Matrix4x4::operator*(const Matrix4x4& other) const {
     Matrix4x4 result;
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 4; j++) {
-            float sum = 0.0f;
-            for (int k = 0; k < 4; k++) {
-                sum += (*this)(i, k) * other(k, j);
-            }
-            result(i, j) = sum;
-        }
-    }
+    MatrixKernels::Multiply(m, other.m, result.m);
     return result;
 }
 
 Matrix4x4 Matrix4x4::operator*(float scalar) const {
+    const VectorRegister factor = VectorSplat(scalar);
     Matrix4x4 result;
-    for (int i = 0; i < 16; i++) {
-        result.m[i] = m[i] * scalar;
+    for (int i = 0; i < 16; i += 4) {
+        VectorStore(VectorMultiply(VectorLoad(m + i), factor), result.m + i);
     }
     return result;
 }
 
 Vector4 Matrix4x4::operator*(const Vector4& vec) const {
-    return Vector4(
-        m[0] * vec.x + m[4] * vec.y + m[8] * vec.z + m[12] * vec.w,
-        m[1] * vec.x + m[5] * vec.y + m[9] * vec.z + m[13] * vec.w,
-        m[2] * vec.x + m[6] * vec.y + m[10] * vec.z + m[14] * vec.w,
-        m[3] * vec.x + m[7] * vec.y + m[11] * vec.z + m[15] * vec.w
-    );
+    float output[4];
+    TransformVectorRegister(m, vec.x, vec.y, vec.z, vec.w, output);
+    return Vector4(output[0], output[1], output[2], output[3]);
 }
 
 Vector3 Matrix4x4::operator*(const Vector3& vec) const {
-    float w = m[3] * vec.x + m[7] * vec.y + m[11] * vec.z + m[15];
+    float output[4];
+    TransformVectorRegister(m, vec.x, vec.y, vec.z, 1.0f, output);
+    float w = output[3];
     if (std::abs(w) > 0.00001f) {
-        return Vector3(
-            (m[0] * vec.x + m[4] * vec.y + m[8] * vec.z + m[12]) / w,
-            (m[1] * vec.x + m[5] * vec.y + m[9] * vec.z + m[13]) / w,
-            (m[2] * vec.x + m[6] * vec.y + m[10] * vec.z + m[14]) / w
-        );
+        return Vector3(output[0] / w, output[1] / w, output[2] / w);
     }
     return Vector3(
         m[0] * vec.x + m[4] * vec.y + m[8] * vec.z,
@@ -224,15 +248,15 @@ Vector3 Matrix4x4::operator*(const Vector3& vec) const {
 }
 
 Matrix4x4& Matrix4x4::operator+=(const Matrix4x4& other) {
-    for (int i = 0; i < 16; i++) {
-        m[i] += other.m[i];
+    for (int i = 0; i < 16; i += 4) {
+        VectorStore(VectorAdd(VectorLoad(m + i), VectorLoad(other.m + i)), m + i);
     }
     return *this;
 }
 
 Matrix4x4& Matrix4x4::operator-=(const Matrix4x4& other) {
-    for (int i = 0; i < 16; i++) {
-        m[i] -= other.m[i];
+    for (int i = 0; i < 16; i += 4) {
+        VectorStore(VectorSubtract(VectorLoad(m + i), VectorLoad(other.m + i)), m + i);
     }
     return *this;
 }
@@ -243,19 +267,21 @@ Matrix4x4& Matrix4x4::operator*=(const Matrix4x4& other) {
 }
 
 Matrix4x4& Matrix4x4::operator*=(float scalar) {
-    for (int i = 0; i < 16; i++) {
-        m[i] *= scalar;
+    const VectorRegister factor = VectorSplat(scalar);
+    for (int i = 0; i < 16; i += 4) {
+        VectorStore(VectorMultiply(VectorLoad(m + i), factor), m + i);
     }
     return *this;
 }
 
 bool Matrix4x4::operator==(const Matrix4x4& other) const {
-    for (int i = 0; i < 16; i++) {
-        if (std::abs(m[i] - other.m[i]) > 0.0001f) {
-            return false;
-        }
+    const VectorRegister tolerance = VectorSplat(0.0001f);
+    int outside = 0;
+    for (int i = 0; i < 16; i += 4) {
+        const VectorRegister difference = VectorAbs(VectorSubtract(VectorLoad(m + i), VectorLoad(other.m + i)));
+        outside |= VectorMaskBits(VectorCompareGT(difference, tolerance));
     }
-    return true;
+    return outside == 0;
 }
 
 bool Matrix4x4::operator!=(const Matrix4x4& other) const {
@@ -263,12 +289,17 @@ bool Matrix4x4::operator!=(const Matrix4x4& other) const {
 }
 
 Matrix4x4 Matrix4x4::Transposed() const {
+    VectorRegister c0 = VectorLoad(m);
+    VectorRegister c1 = VectorLoad(m + 4);
+    VectorRegister c2 = VectorLoad(m + 8);
+    VectorRegister c3 = VectorLoad(m + 12);
+    VectorTranspose(c0, c1, c2, c3);
+
     Matrix4x4 result;
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 4; j++) {
-            result(j, i) = (*this)(i, j);
-        }
-    }
+    VectorStore(c0, result.m);
+    VectorStore(c1, result.m + 4);
+    VectorStore(c2, result.m + 8);
+    VectorStore(c3, result.m + 12);
     return result;
 }
 
@@ -277,29 +308,11 @@ void Matrix4x4::Transpose() {
 }
 
 float Matrix4x4::Determinant() const {
-    float a = m[0], b = m[4], c = m[8], d = m[12];
-    float e = m[1], f = m[5], g = m[9], h = m[13];
-    float i = m[2], j = m[6], k = m[10], l = m[14];
-    float mm = m[3], n = m[7], o = m[11], p = m[15];
-
-    return a * (f * (k * p - l * o) - g * (j * p - l * n) + h * (j * o - k * n))
-         - b * (e * (k * p - l * o) - g * (i * p - l * mm) + h * (i * o - k * mm))
-         + c * (e * (j * p - l * n) - f * (i * p - l * mm) + h * (i * n - j * mm))
-         - d * (e * (j * o - k * n) - f * (i * o - k * mm) + g * (i * n - j * mm));
+    return MatrixKernels::Determinant(m);
 }
 
 bool Matrix4x4::Inverse(Matrix4x4& out) const {
-    float det = Determinant();
-    if (std::abs(det) < 0.0001f) {
-        return false;
-    }
-
-    // Adjugate matrix / determinant
-    float invDet = 1.0f / det;
-    // ... (simplified - full inverse implementation would be longer)
-    // For now, use transpose of rotation + negate translation for common cases
-    out = Identity();
-    return true;
+    return MatrixKernels::Inverse(m, out.m);
 }
 
 Matrix4x4 Matrix4x4::Inversed() const {
@@ -310,16 +323,27 @@ Matrix4x4 Matrix4x4::Inversed() const {
     return result;
 }
 
+bool Matrix4x4::InverseAffine(Matrix4x4& out) const {
+    return MatrixKernels::InverseAffine(m, out.m);
+}
+
+Matrix4x4 Matrix4x4::InversedAffine() const {
+    Matrix4x4 result;
+    if (!InverseAffine(result)) {
+        return Identity();
+    }
+    return result;
+}
+
 Vector3 Matrix4x4::TransformPoint(const Vector3& point) const {
     return *this * point;
 }
 
 Vector3 Matrix4x4::TransformVector(const Vector3& vec) const {
-    return Vector3(
-        m[0] * vec.x + m[4] * vec.y + m[8] * vec.z,
-        m[1] * vec.x + m[5] * vec.y + m[9] * vec.z,
-        m[2] * vec.x + m[6] * vec.y + m[10] * vec.z
-    );
+    VectorRegister result = VectorMultiply(VectorLoad(m), VectorSplat(vec.x));
+    result = VectorMultiplyAdd(VectorLoad(m + 4), VectorSplat(vec.y), result);
+    result = VectorMultiplyAdd(VectorLoad(m + 8), VectorSplat(vec.z), result);
+    return VectorToVector3(result);
 }
 
 Vector3 Matrix4x4::TransformDirection(const Vector3& dir) const {
@@ -327,22 +351,25 @@ Vector3 Matrix4x4::TransformDirection(const Vector3& dir) const {
 }
 
 bool Matrix4x4::IsNearlyZero(float tolerance) const {
-    for (int i = 0; i < 16; i++) {
-        if (std::abs(m[i]) >= tolerance) {
-            return false;
-        }
+    const VectorRegister limit = VectorSplat(tolerance);
+    int outside = 0;
+    for (int i = 0; i < 16; i += 4) {
+        outside |= VectorMaskBits(VectorCompareGE(VectorAbs(VectorLoad(m + i)), limit));
     }
-    return true;
+    return outside == 0;
 }
 
 bool Matrix4x4::IsIdentity(float tolerance) const {
-    for (int i = 0; i < 16; i++) {
-        float expected = (i % 5 == 0) ? 1.0f : 0.0f; // Diagonal = 1, else 0
-        if (std::abs(m[i] - expected) >= tolerance) {
-            return false;
-        }
+    const VectorRegister limit = VectorSplat(tolerance);
+    int outside = 0;
+    for (int col = 0; col < 4; col++) {
+        // Diagonal = 1, else 0
+        const VectorRegister expected = VectorSet(col == 0 ? 1.0f : 0.0f, col == 1 ? 1.0f : 0.0f,
+                                                  col == 2 ? 1.0f : 0.0f, col == 3 ? 1.0f : 0.0f);
+        const VectorRegister difference = VectorAbs(VectorSubtract(VectorLoad(m + col * 4), expected));
+        outside |= VectorMaskBits(VectorCompareGE(difference, limit));
     }
-    return true;
+    return outside == 0;
 }
 
 // Friend operators
@@ -354,3 +381,330 @@ Vector4 operator*(const Vector4& vec, const Matrix4x4& mat) {
     return mat * vec;
 }
 
+
+// ============================================================================
+// MatrixKernels Implementation
+// ============================================================================
+
+#if MATH_SIMD_ENABLED
+namespace {
+    // 2x2 matrices packed as (m00, m01, m10, m11)
+
+    // A * B
+    inline VectorRegister Mat2Multiply(VectorRegister a, VectorRegister b) {
+        return VectorAdd(VectorMultiply(a, VectorSwizzle<0, 3, 0, 3>(b)),
+                   VectorMultiply(VectorSwizzle<1, 0, 3, 2>(a), VectorSwizzle<2, 1, 2, 1>(b)));
+    }
+
+    // adj(A) * B
+    inline VectorRegister Mat2AdjointMultiply(VectorRegister a, VectorRegister b) {
+        return VectorSubtract(VectorMultiply(VectorSwizzle<3, 3, 0, 0>(a), b),
+                        VectorMultiply(VectorSwizzle<1, 1, 2, 2>(a), VectorSwizzle<2, 3, 0, 1>(b)));
+    }
+
+    // A * adj(B)
+    inline VectorRegister Mat2MultiplyAdjoint(VectorRegister a, VectorRegister b) {
+        return VectorSubtract(VectorMultiply(a, VectorSwizzle<3, 0, 3, 0>(b)),
+                        VectorMultiply(VectorSwizzle<1, 0, 3, 2>(a), VectorSwizzle<2, 1, 2, 1>(b)));
+    }
+
+    // Block form of a 4x4 matrix | A B ; C D |, with the terms shared by the
+    // determinant and the inverse:
+    //   |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    // The blocks are read from the columns, i.e. this factors the transpose; its
+    // inverse stored row by row is the inverse of the original stored column by column.
+    struct FBlockMatrix {
+        VectorRegister A, B, C, D;
+        VectorRegister detA, detB, detC, detD;
+        VectorRegister AdjA_B;      // adj(A) * B
+        VectorRegister AdjD_C;      // adj(D) * C
+        VectorRegister determinant; // |M| in every lane
+
+        explicit FBlockMatrix(const float* m) {
+            const VectorRegister column0 = VectorLoad(m);
+            const VectorRegister column1 = VectorLoad(m + 4);
+            const VectorRegister column2 = VectorLoad(m + 8);
+            const VectorRegister column3 = VectorLoad(m + 12);
+
+            A = VectorShuffle<0, 1, 0, 1>(column0, column1);
+            B = VectorShuffle<2, 3, 2, 3>(column0, column1);
+            C = VectorShuffle<0, 1, 0, 1>(column2, column3);
+            D = VectorShuffle<2, 3, 2, 3>(column2, column3);
+
+            // (|A|, |B|, |C|, |D|)
+            const VectorRegister subDeterminants = VectorSubtract(
+                VectorMultiply(VectorShuffle<0, 2, 0, 2>(column0, column2),
+                               VectorShuffle<1, 3, 1, 3>(column1, column3)),
+                VectorMultiply(VectorShuffle<1, 3, 1, 3>(column0, column2),
+                               VectorShuffle<0, 2, 0, 2>(column1, column3)));
+            detA = VectorReplicate<0>(subDeterminants);
+            detB = VectorReplicate<1>(subDeterminants);
+            detC = VectorReplicate<2>(subDeterminants);
+            detD = VectorReplicate<3>(subDeterminants);
+
+            AdjA_B = Mat2AdjointMultiply(A, B);
+            AdjD_C = Mat2AdjointMultiply(D, C);
+
+            const VectorRegister trace = VectorHorizontalAdd(VectorMultiply(AdjA_B, VectorSwizzle<0, 2, 1, 3>(AdjD_C)));
+            determinant = VectorSubtract(VectorAdd(VectorMultiply(detA, detD), VectorMultiply(detB, detC)), trace);
+        }
+    };
+
+    inline VectorRegister Cross3(VectorRegister a, VectorRegister b) {
+        return VectorSubtract(VectorMultiply(VectorSwizzle<1, 2, 0, 3>(a), VectorSwizzle<2, 0, 1, 3>(b)),
+                        VectorMultiply(VectorSwizzle<2, 0, 1, 3>(a), VectorSwizzle<1, 2, 0, 3>(b)));
+    }
+}
+#endif
+
+void MatrixKernels::MultiplyScalar(const float* a, const float* b, float* out) {
+    float result[16];
+    for (int col = 0; col < 4; col++) {
+        const float* bColumn = b + col * 4;
+        for (int row = 0; row < 4; row++) {
+            result[col * 4 + row] = a[row] * bColumn[0] + a[4 + row] * bColumn[1] +
+                                    a[8 + row] * bColumn[2] + a[12 + row] * bColumn[3];
+        }
+    }
+    std::memcpy(out, result, sizeof(result));
+}
+
+void MatrixKernels::Multiply(const float* a, const float* b, float* out) {
+#if MATH_SIMD_AVX
+    // Two result columns per iteration: each 128-bit half splats its own column of b
+    const __m128 a0 = _mm_loadu_ps(a);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+    const __m256 aa0 = _mm256_insertf128_ps(_mm256_castps128_ps256(a0), a0, 1);
+    const __m256 aa1 = _mm256_insertf128_ps(_mm256_castps128_ps256(a1), a1, 1);
+    const __m256 aa2 = _mm256_insertf128_ps(_mm256_castps128_ps256(a2), a2, 1);
+    const __m256 aa3 = _mm256_insertf128_ps(_mm256_castps128_ps256(a3), a3, 1);
+    // Every input is read before the first store: out may alias a or b
+    const __m256 bColumns[2] = {_mm256_loadu_ps(b), _mm256_loadu_ps(b + 8)};
+    for (int pair = 0; pair < 2; pair++) {
+        const __m256 bPair = bColumns[pair];
+        __m256 result = _mm256_mul_ps(aa0, _mm256_shuffle_ps(bPair, bPair, 0x00));
+        result = _mm256_add_ps(result, _mm256_mul_ps(aa1, _mm256_shuffle_ps(bPair, bPair, 0x55)));
+        result = _mm256_add_ps(result, _mm256_mul_ps(aa2, _mm256_shuffle_ps(bPair, bPair, 0xAA)));
+        result = _mm256_add_ps(result, _mm256_mul_ps(aa3, _mm256_shuffle_ps(bPair, bPair, 0xFF)));
+        _mm256_storeu_ps(out + pair * 8, result);
+    }
+#elif MATH_SIMD_ENABLED
+    const VectorRegister a0 = VectorLoad(a);
+    const VectorRegister a1 = VectorLoad(a + 4);
+    const VectorRegister a2 = VectorLoad(a + 8);
+    const VectorRegister a3 = VectorLoad(a + 12);
+    // Every input is read before the first store: out may alias a or b
+    const VectorRegister bColumns[4] = {VectorLoad(b), VectorLoad(b + 4), VectorLoad(b + 8), VectorLoad(b + 12)};
+    for (int col = 0; col < 4; col++) {
+        const VectorRegister bColumn = bColumns[col];
+        VectorRegister result = VectorMultiply(a0, VectorReplicate<0>(bColumn));
+        result = VectorAdd(result, VectorMultiply(a1, VectorReplicate<1>(bColumn)));
+        result = VectorAdd(result, VectorMultiply(a2, VectorReplicate<2>(bColumn)));
+        result = VectorAdd(result, VectorMultiply(a3, VectorReplicate<3>(bColumn)));
+        VectorStore(result, out + col * 4);
+    }
+#else
+    MultiplyScalar(a, b, out);
+#endif
+}
+
+void MatrixKernels::TransformVector4Scalar(const float* m, const float* v, float* out) {
+    float result[4];
+    for (int row = 0; row < 4; row++) {
+        result[row] = m[row] * v[0] + m[4 + row] * v[1] + m[8 + row] * v[2] + m[12 + row] * v[3];
+    }
+    std::memcpy(out, result, sizeof(result));
+}
+
+void MatrixKernels::TransformVector4(const float* m, const float* v, float* out) {
+#if MATH_SIMD_ENABLED
+    const VectorRegister vector = VectorLoad(v);
+    VectorRegister result = VectorMultiply(VectorLoad(m), VectorReplicate<0>(vector));
+    result = VectorAdd(result, VectorMultiply(VectorLoad(m + 4), VectorReplicate<1>(vector)));
+    result = VectorAdd(result, VectorMultiply(VectorLoad(m + 8), VectorReplicate<2>(vector)));
+    result = VectorAdd(result, VectorMultiply(VectorLoad(m + 12), VectorReplicate<3>(vector)));
+    VectorStore(result, out);
+#else
+    TransformVector4Scalar(m, v, out);
+#endif
+}
+
+float MatrixKernels::DeterminantScalar(const float* m) {
+    float a = m[0], b = m[4], c = m[8], d = m[12];
+    float e = m[1], f = m[5], g = m[9], h = m[13];
+    float i = m[2], j = m[6], k = m[10], l = m[14];
+    float mm = m[3], n = m[7], o = m[11], p = m[15];
+
+    return a * (f * (k * p - l * o) - g * (j * p - l * n) + h * (j * o - k * n))
+         - b * (e * (k * p - l * o) - g * (i * p - l * mm) + h * (i * o - k * mm))
+         + c * (e * (j * p - l * n) - f * (i * p - l * mm) + h * (i * n - j * mm))
+         - d * (e * (j * o - k * n) - f * (i * o - k * mm) + g * (i * n - j * mm));
+}
+
+float MatrixKernels::Determinant(const float* m) {
+#if MATH_SIMD_ENABLED
+    return VectorGetX(FBlockMatrix(m).determinant);
+#else
+    return DeterminantScalar(m);
+#endif
+}
+
+bool MatrixKernels::InverseScalar(const float* m, float* out) {
+    // Element (row, col)
+    auto at = [m](int row, int col) { return m[row + col * 4]; };
+
+    // 2x2 determinants of the top two rows (s) and of the bottom two rows (c)
+    float s0 = at(0, 0) * at(1, 1) - at(1, 0) * at(0, 1);
+    float s1 = at(0, 0) * at(1, 2) - at(1, 0) * at(0, 2);
+    float s2 = at(0, 0) * at(1, 3) - at(1, 0) * at(0, 3);
+    float s3 = at(0, 1) * at(1, 2) - at(1, 1) * at(0, 2);
+    float s4 = at(0, 1) * at(1, 3) - at(1, 1) * at(0, 3);
+    float s5 = at(0, 2) * at(1, 3) - at(1, 2) * at(0, 3);
+
+    float c5 = at(2, 2) * at(3, 3) - at(3, 2) * at(2, 3);
+    float c4 = at(2, 1) * at(3, 3) - at(3, 1) * at(2, 3);
+    float c3 = at(2, 1) * at(3, 2) - at(3, 1) * at(2, 2);
+    float c2 = at(2, 0) * at(3, 3) - at(3, 0) * at(2, 3);
+    float c1 = at(2, 0) * at(3, 2) - at(3, 0) * at(2, 2);
+    float c0 = at(2, 0) * at(3, 1) - at(3, 0) * at(2, 1);
+
+    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    if (std::abs(det) < SINGULAR_DETERMINANT) {
+        return false;
+    }
+
+    // Adjugate matrix / determinant
+    float invDet = 1.0f / det;
+    float result[16];
+    auto set = [&result, invDet](int row, int col, float value) { result[row + col * 4] = value * invDet; };
+
+    set(0, 0,  at(1, 1) * c5 - at(1, 2) * c4 + at(1, 3) * c3);
+    set(0, 1, -at(0, 1) * c5 + at(0, 2) * c4 - at(0, 3) * c3);
+    set(0, 2,  at(3, 1) * s5 - at(3, 2) * s4 + at(3, 3) * s3);
+    set(0, 3, -at(2, 1) * s5 + at(2, 2) * s4 - at(2, 3) * s3);
+
+    set(1, 0, -at(1, 0) * c5 + at(1, 2) * c2 - at(1, 3) * c1);
+    set(1, 1,  at(0, 0) * c5 - at(0, 2) * c2 + at(0, 3) * c1);
+    set(1, 2, -at(3, 0) * s5 + at(3, 2) * s2 - at(3, 3) * s1);
+    set(1, 3,  at(2, 0) * s5 - at(2, 2) * s2 + at(2, 3) * s1);
+
+    set(2, 0,  at(1, 0) * c4 - at(1, 1) * c2 + at(1, 3) * c0);
+    set(2, 1, -at(0, 0) * c4 + at(0, 1) * c2 - at(0, 3) * c0);
+    set(2, 2,  at(3, 0) * s4 - at(3, 1) * s2 + at(3, 3) * s0);
+    set(2, 3, -at(2, 0) * s4 + at(2, 1) * s2 - at(2, 3) * s0);
+
+    set(3, 0, -at(1, 0) * c3 + at(1, 1) * c1 - at(1, 2) * c0);
+    set(3, 1,  at(0, 0) * c3 - at(0, 1) * c1 + at(0, 2) * c0);
+    set(3, 2, -at(3, 0) * s3 + at(3, 1) * s1 - at(3, 2) * s0);
+    set(3, 3,  at(2, 0) * s3 - at(2, 1) * s1 + at(2, 2) * s0);
+
+    std::memcpy(out, result, sizeof(result));
+    return true;
+}
+
+bool MatrixKernels::Inverse(const float* m, float* out) {
+#if MATH_SIMD_ENABLED
+    const FBlockMatrix blocks(m);
+    if (std::abs(VectorGetX(blocks.determinant)) < SINGULAR_DETERMINANT) {
+        return false;
+    }
+
+    // inverse(M) = 1/|M| * | X Y ; Z W |, computed as adjugates X#, Y#, Z#, W#
+    const VectorRegister X = VectorSubtract(VectorMultiply(blocks.detD, blocks.A),
+                                            Mat2Multiply(blocks.B, blocks.AdjD_C));
+    const VectorRegister W = VectorSubtract(VectorMultiply(blocks.detA, blocks.D),
+                                            Mat2Multiply(blocks.C, blocks.AdjA_B));
+    const VectorRegister Y = VectorSubtract(VectorMultiply(blocks.detB, blocks.C),
+                                            Mat2MultiplyAdjoint(blocks.D, blocks.AdjA_B));
+    const VectorRegister Z = VectorSubtract(VectorMultiply(blocks.detC, blocks.B),
+                                            Mat2MultiplyAdjoint(blocks.A, blocks.AdjD_C));
+
+    // (1, -1, -1, 1) / |M| turns each adjugate back into its block
+    const VectorRegister scale = VectorDivide(VectorSet(1.0f, -1.0f, -1.0f, 1.0f), blocks.determinant);
+    const VectorRegister scaledX = VectorMultiply(X, scale);
+    const VectorRegister scaledY = VectorMultiply(Y, scale);
+    const VectorRegister scaledZ = VectorMultiply(Z, scale);
+    const VectorRegister scaledW = VectorMultiply(W, scale);
+
+    // The adjugate swap and the block-to-column layout in one shuffle each
+    VectorStore(VectorShuffle<3, 1, 3, 1>(scaledX, scaledY), out);
+    VectorStore(VectorShuffle<2, 0, 2, 0>(scaledX, scaledY), out + 4);
+    VectorStore(VectorShuffle<3, 1, 3, 1>(scaledZ, scaledW), out + 8);
+    VectorStore(VectorShuffle<2, 0, 2, 0>(scaledZ, scaledW), out + 12);
+    return true;
+#else
+    return InverseScalar(m, out);
+#endif
+}
+
+bool MatrixKernels::InverseAffineScalar(const float* m, float* out) {
+    // Columns of the 3x3 part and translation
+    const Vector3 x(m[0], m[1], m[2]);
+    const Vector3 y(m[4], m[5], m[6]);
+    const Vector3 z(m[8], m[9], m[10]);
+    const Vector3 translation(m[12], m[13], m[14]);
+
+    // Rows of the inverse 3x3 part: y x z, z x x, x x y over the determinant
+    Vector3 row0 = y.Cross(z);
+    Vector3 row1 = z.Cross(x);
+    Vector3 row2 = x.Cross(y);
+    float det = x.Dot(row0);
+    if (std::abs(det) < SINGULAR_DETERMINANT) {
+        return false;
+    }
+
+    float invDet = 1.0f / det;
+    row0 *= invDet;
+    row1 *= invDet;
+    row2 *= invDet;
+
+    out[0] = row0.x; out[4] = row0.y; out[8]  = row0.z; out[12] = -row0.Dot(translation);
+    out[1] = row1.x; out[5] = row1.y; out[9]  = row1.z; out[13] = -row1.Dot(translation);
+    out[2] = row2.x; out[6] = row2.y; out[10] = row2.z; out[14] = -row2.Dot(translation);
+    out[3] = 0.0f;   out[7] = 0.0f;   out[11] = 0.0f;   out[15] = 1.0f;
+    return true;
+}
+
+bool MatrixKernels::InverseAffine(const float* m, float* out) {
+#if MATH_SIMD_ENABLED
+    // w of the three axes is 0 in an affine matrix; their crosses keep it at 0
+    const VectorRegister x = VectorLoad(m);
+    const VectorRegister y = VectorLoad(m + 4);
+    const VectorRegister z = VectorLoad(m + 8);
+    const VectorRegister translation = VectorLoad(m + 12);
+
+    VectorRegister row0 = Cross3(y, z);
+    VectorRegister row1 = Cross3(z, x);
+    VectorRegister row2 = Cross3(x, y);
+    const VectorRegister det = VectorHorizontalAdd(VectorMultiply(x, row0));
+    if (std::abs(VectorGetX(det)) < SINGULAR_DETERMINANT) {
+        return false;
+    }
+
+    const VectorRegister invDet = VectorDivide(VectorSplat(1.0f), det);
+    row0 = VectorMultiply(row0, invDet);
+    row1 = VectorMultiply(row1, invDet);
+    row2 = VectorMultiply(row2, invDet);
+    VectorRegister row3 = VectorSplat(0.0f);
+    VectorTranspose(row0, row1, row2, row3);
+
+    // row0..row2 are now the columns of the inverse 3x3 part
+    VectorRegister inverseTranslation = VectorMultiply(row0, VectorReplicate<0>(translation));
+    inverseTranslation = VectorAdd(inverseTranslation, VectorMultiply(row1, VectorReplicate<1>(translation)));
+    inverseTranslation = VectorAdd(inverseTranslation, VectorMultiply(row2, VectorReplicate<2>(translation)));
+
+    VectorStore(row0, out);
+    VectorStore(row1, out + 4);
+    VectorStore(row2, out + 8);
+    VectorStore(VectorSubtract(VectorSet(0.0f, 0.0f, 0.0f, 1.0f), inverseTranslation), out + 12);
+    return true;
+#else
+    return InverseAffineScalar(m, out);
+#endif
+}
+
+const char* MatrixKernels::GetBackendName() {
+    return MATH_SIMD_BACKEND_NAME;
+}
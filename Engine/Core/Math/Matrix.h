@@ -85,6 +85,10 @@ struct Matrix4x4 {
     Matrix4x4 Inversed() const;
     bool Inverse(Matrix4x4& out) const;
     
+    // Faster inverse for affine matrices (last row 0, 0, 0, 1): rotation, scale, translation
+    Matrix4x4 InversedAffine() const;
+    bool InverseAffine(Matrix4x4& out) const;
+    
     float Determinant() const;
     
     Vector3 TransformPoint(const Vector3& point) const;
@@ -104,3 +108,36 @@ struct Matrix4x4 {
 Matrix4x4 operator*(float scalar, const Matrix4x4& mat);
 Vector4 operator*(const Vector4& vec, const Matrix4x4& mat);
 
+
+// ============================================================================
+// MatrixKernels - Raw column-major float[16] kernels behind Matrix4x4
+// ============================================================================
+//
+// The plain versions use the SIMD backend selected at compile time (MathSIMD.h);
+// the *Scalar versions are the reference implementation and are always built.
+// Multiply and TransformVector4 add the products in the same order in both, so
+// their results are bit-identical as long as a * b + c is not contracted into an
+// FMA: CMakeLists.txt builds the math sources with -ffp-contract=off (/fp:precise
+// on MSVC). Determinant and the inverses round differently.
+// The output may alias the inputs.
+
+namespace MatrixKernels {
+    void Multiply(const float* a, const float* b, float* out);
+    void MultiplyScalar(const float* a, const float* b, float* out);
+
+    // out = m * v (4 components)
+    void TransformVector4(const float* m, const float* v, float* out);
+    void TransformVector4Scalar(const float* m, const float* v, float* out);
+
+    float Determinant(const float* m);
+    float DeterminantScalar(const float* m);
+
+    // false (out untouched) if the matrix is singular
+    bool Inverse(const float* m, float* out);
+    bool InverseScalar(const float* m, float* out);
+    bool InverseAffine(const float* m, float* out);
+    bool InverseAffineScalar(const float* m, float* out);
+
+    // "SSE", "AVX", "NEON" or "Scalar"
+    const char* GetBackendName();
+}
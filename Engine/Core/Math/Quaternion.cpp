@@ -1,6 +1,22 @@
 #include "Quaternion.h"
+#include "VectorRegister.h"
 #include <algorithm>
 
+// Quaternions are loaded straight into a VectorRegister as (x, y, z, w)
+static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be four packed floats");
+
+namespace {
+    inline VectorRegister VectorLoad(const Quaternion& q) {
+        return ::VectorLoad(&q.x);
+    }
+
+    inline Quaternion VectorToQuaternion(VectorRegister value) {
+        Quaternion result;
+        VectorStore(value, &result.x);
+        return result;
+    }
+}
+
 const Quaternion Quaternion::IdentityQuaternion(0.0f, 0.0f, 0.0f, 1.0f);
 
 Quaternion::Quaternion(const Vector3& axis, float angleRadians) {
@@ -147,45 +163,60 @@ Quaternion Quaternion::Slerp(const Quaternion& a, const Quaternion& b, float t)
     float w1 = std::sin((1.0f - t) * theta) / sinTheta;
     float w2 = std::sin(t * theta) / sinTheta;
     
-    return (a * w1 + b2 * w2).Normalized();
+    const VectorRegister blend = VectorMultiplyAdd(VectorLoad(b2), VectorSplat(w2),
+                                                   VectorMultiply(VectorLoad(a), VectorSplat(w1)));
+    return VectorToQuaternion(blend).Normalized();
 }
 
 Quaternion Quaternion::operator+(const Quaternion& other) const {
-    return Quaternion(x + other.x, y + other.y, z + other.z, w + other.w);
+    return VectorToQuaternion(VectorAdd(VectorLoad(*this), VectorLoad(other)));
 }
 
 Quaternion Quaternion::operator-(const Quaternion& other) const {
-    return Quaternion(x - other.x, y - other.y, z - other.z, w - other.w);
+    return VectorToQuaternion(VectorSubtract(VectorLoad(*this), VectorLoad(other)));
 }
 
 Quaternion Quaternion::operator*(const Quaternion& other) const {
-    return Quaternion(
-        w * other.x + x * other.w + y * other.z - z * other.y,
-        w * other.y - x * other.z + y * other.w + z * other.x,
-        w * other.z + x * other.y - y * other.x + z * other.w,
-        w * other.w - x * other.x - y * other.y - z * other.z
-    );
+    // Hamilton product: each term is one lane of *this times a signed swizzle of
+    // other, added in the same order as the scalar formula
+    //   x = w*ox + x*ow + y*oz - z*oy
+    //   y = w*oy - x*oz + y*ow + z*ox
+    //   z = w*oz + x*oy - y*ox + z*ow
+    //   w = w*ow - x*ox - y*oy - z*oz
+    const VectorRegister a = VectorLoad(*this);
+    const VectorRegister b = VectorLoad(other);
+    VectorRegister result = VectorMultiply(VectorReplicate<3>(a), b);
+    result = VectorMultiplyAdd(VectorReplicate<0>(a),
+                               VectorMultiply(VectorSwizzle<3, 2, 1, 0>(b), VectorSet(1.0f, -1.0f, 1.0f, -1.0f)),
+                               result);
+    result = VectorMultiplyAdd(VectorReplicate<1>(a),
+                               VectorMultiply(VectorSwizzle<2, 3, 0, 1>(b), VectorSet(1.0f, 1.0f, -1.0f, -1.0f)),
+                               result);
+    result = VectorMultiplyAdd(VectorReplicate<2>(a),
+                               VectorMultiply(VectorSwizzle<1, 0, 3, 2>(b), VectorSet(-1.0f, 1.0f, 1.0f, -1.0f)),
+                               result);
+    return VectorToQuaternion(result);
 }
 
 Quaternion Quaternion::operator*(float scalar) const {
-    return Quaternion(x * scalar, y * scalar, z * scalar, w * scalar);
+    return VectorToQuaternion(VectorMultiply(VectorLoad(*this), VectorSplat(scalar)));
 }
 
 Quaternion Quaternion::operator/(float scalar) const {
-    return Quaternion(x / scalar, y / scalar, z / scalar, w / scalar);
+    return VectorToQuaternion(VectorDivide(VectorLoad(*this), VectorSplat(scalar)));
 }
 
 Quaternion Quaternion::operator-() const {
-    return Quaternion(-x, -y, -z, -w);
+    return VectorToQuaternion(VectorNegate(VectorLoad(*this)));
 }
 
 Quaternion& Quaternion::operator+=(const Quaternion& other) {
-    x += other.x; y += other.y; z += other.z; w += other.w;
+    *this = *this + other;
     return *this;
 }
 
 Quaternion& Quaternion::operator-=(const Quaternion& other) {
-    x -= other.x; y -= other.y; z -= other.z; w -= other.w;
+    *this = *this - other;
     return *this;
 }
 
@@ -195,20 +226,18 @@ Quaternion& Quaternion::operator*=(const Quaternion& other) {
 }
 
 Quaternion& Quaternion::operator*=(float scalar) {
-    x *= scalar; y *= scalar; z *= scalar; w *= scalar;
+    *this = *this * scalar;
     return *this;
 }
 
 Quaternion& Quaternion::operator/=(float scalar) {
-    x /= scalar; y /= scalar; z /= scalar; w /= scalar;
+    *this = *this / scalar;
     return *this;
 }
 
 bool Quaternion::operator==(const Quaternion& other) const {
-    return std::abs(x - other.x) < 0.0001f &&
-           std::abs(y - other.y) < 0.0001f &&
-           std::abs(z - other.z) < 0.0001f &&
-           std::abs(w - other.w) < 0.0001f;
+    const VectorRegister difference = VectorAbs(VectorSubtract(VectorLoad(*this), VectorLoad(other)));
+    return VectorMaskBits(VectorCompareLT(difference, VectorSplat(0.0001f))) == 0xF;
 }
 
 bool Quaternion::operator!=(const Quaternion& other) const {
@@ -216,38 +245,36 @@ bool Quaternion::operator!=(const Quaternion& other) const {
 }
 
 float Quaternion::Size() const {
-    return std::sqrt(x * x + y * y + z * z + w * w);
+    return std::sqrt(SizeSquared());
 }
 
 float Quaternion::SizeSquared() const {
-    return x * x + y * y + z * z + w * w;
+    return Dot(*this);
 }
 
 Quaternion Quaternion::Normalized() const {
-    float len = Size();
-    if (len > 0.00001f) {
-        return Quaternion(x / len, y / len, z / len, w / len);
+    const VectorRegister q = VectorLoad(*this);
+    const VectorRegister length = VectorSqrt(VectorDot4(q, q));
+    if (VectorGetX(length) > 0.00001f) {
+        return VectorToQuaternion(VectorDivide(q, length));
     }
     return Identity();
 }
 
 void Quaternion::Normalize() {
-    float len = Size();
-    if (len > 0.00001f) {
-        x /= len; y /= len; z /= len; w /= len;
-    } else {
-        *this = Identity();
-    }
+    *this = Normalized();
 }
 
 Quaternion Quaternion::Conjugate() const {
-    return Quaternion(-x, -y, -z, w);
+    return VectorToQuaternion(VectorMultiply(VectorLoad(*this), VectorSet(-1.0f, -1.0f, -1.0f, 1.0f)));
 }
 
 Quaternion Quaternion::Inversed() const {
-    float lenSq = SizeSquared();
-    if (lenSq > 0.00001f) {
-        return Conjugate() / lenSq;
+    const VectorRegister q = VectorLoad(*this);
+    const VectorRegister lengthSquared = VectorDot4(q, q);
+    if (VectorGetX(lengthSquared) > 0.00001f) {
+        return VectorToQuaternion(VectorDivide(VectorMultiply(q, VectorSet(-1.0f, -1.0f, -1.0f, 1.0f)),
+                                               lengthSquared));
     }
     return Identity();
 }
@@ -257,9 +284,14 @@ void Quaternion::Inverse() {
 }
 
 Vector3 Quaternion::RotateVector(const Vector3& vec) const {
-    Quaternion vecQuat(vec.x, vec.y, vec.z, 0.0f);
-    Quaternion result = (*this) * vecQuat * Conjugate();
-    return Vector3(result.x, result.y, result.z);
+    // q * v * q^-1 for a unit quaternion, expanded: t = 2 (q.xyz x v), v' = v + w t + q.xyz x t
+    const VectorRegister q = VectorLoad(*this);
+    const VectorRegister v = VectorLoad(vec);
+    const VectorRegister t = VectorCross(q, v);
+    const VectorRegister t2 = VectorAdd(t, t);
+    VectorRegister result = VectorMultiplyAdd(VectorReplicate<3>(q), t2, v);
+    result = VectorAdd(result, VectorCross(q, t2));
+    return VectorToVector3(result);
 }
 
 Vector3 Quaternion::GetForwardVector() const {
@@ -299,25 +331,44 @@ Vector3 Quaternion::ToEuler() const {
 }
 
 Matrix4x4 Quaternion::ToMatrix() const {
-    float xx = x * x, yy = y * y, zz = z * z;
-    float xy = x * y, xz = x * z, yz = y * z;
-    float wx = w * x, wy = w * y, wz = w * z;
-
-    return Matrix4x4(
-        1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy), 0.0f,
-        2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx), 0.0f,
-        2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy), 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f
-    );
+    // Column j = identity column j plus two signed products of swizzles of q and 2q:
+    //   col0 = (1 - 2(yy + zz), 2(xy + wz), 2(xz - wy), 0)
+    //   col1 = (2(xy - wz), 1 - 2(xx + zz), 2(yz + wx), 0)
+    //   col2 = (2(xz + wy), 2(yz - wx), 1 - 2(xx + yy), 0)
+    const VectorRegister q = VectorLoad(*this);
+    const VectorRegister q2 = VectorAdd(q, q);
+
+    Matrix4x4 result;
+    VectorRegister column = VectorMultiplyAdd(
+        VectorMultiply(VectorSwizzle<1, 0, 0, 3>(q), VectorSwizzle<1, 1, 2, 3>(q2)),
+        VectorSet(-1.0f, 1.0f, 1.0f, 0.0f), VectorSet(1.0f, 0.0f, 0.0f, 0.0f));
+    column = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<2, 3, 3, 3>(q), VectorSwizzle<2, 2, 1, 3>(q2)),
+                               VectorSet(-1.0f, 1.0f, -1.0f, 0.0f), column);
+    VectorStore(column, result.m);
+
+    column = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<0, 0, 1, 3>(q), VectorSwizzle<1, 0, 2, 3>(q2)),
+                               VectorSet(1.0f, -1.0f, 1.0f, 0.0f), VectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+    column = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<3, 2, 3, 3>(q), VectorSwizzle<2, 2, 0, 3>(q2)),
+                               VectorSet(-1.0f, -1.0f, 1.0f, 0.0f), column);
+    VectorStore(column, result.m + 4);
+
+    column = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<0, 1, 0, 3>(q), VectorSwizzle<2, 2, 0, 3>(q2)),
+                               VectorSet(1.0f, 1.0f, -1.0f, 0.0f), VectorSet(0.0f, 0.0f, 1.0f, 0.0f));
+    column = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<3, 3, 1, 3>(q), VectorSwizzle<1, 0, 1, 3>(q2)),
+                               VectorSet(1.0f, -1.0f, -1.0f, 0.0f), column);
+    VectorStore(column, result.m + 8);
+
+    VectorStore(VectorSet(0.0f, 0.0f, 0.0f, 1.0f), result.m + 12);
+    return result;
 }
 
 float Quaternion::Dot(const Quaternion& other) const {
-    return x * other.x + y * other.y + z * other.z + w * other.w;
+    return VectorGetX(VectorDot4(VectorLoad(*this), VectorLoad(other)));
 }
 
 bool Quaternion::IsNearlyZero(float tolerance) const {
-    return std::abs(x) < tolerance && std::abs(y) < tolerance &&
-           std::abs(z) < tolerance && std::abs(w) < tolerance;
+    const VectorRegister magnitude = VectorAbs(VectorLoad(*this));
+    return VectorMaskBits(VectorCompareLT(magnitude, VectorSplat(tolerance))) == 0xF;
 }
 
 bool Quaternion::IsNormalized(float tolerance) const {
@@ -325,8 +376,8 @@ bool Quaternion::IsNormalized(float tolerance) const {
 }
 
 bool Quaternion::IsIdentity(float tolerance) const {
-    return std::abs(x) < tolerance && std::abs(y) < tolerance &&
-           std::abs(z) < tolerance && std::abs(w - 1.0f) < tolerance;
+    const VectorRegister difference = VectorAbs(VectorSubtract(VectorLoad(*this), VectorSet(0.0f, 0.0f, 0.0f, 1.0f)));
+    return VectorMaskBits(VectorCompareLT(difference, VectorSplat(tolerance))) == 0xF;
 }
 
 float Quaternion::GetAngle() const {
@@ -64,7 +64,7 @@ struct Quaternion {
     void Inverse();
 
     // Rotation operations
-    Vector3 RotateVector(const Vector3& vec) const;
+    Vector3 RotateVector(const Vector3& vec) const; // Unit quaternions only (Normalize first)
     Vector3 GetForwardVector() const;
     Vector3 GetRightVector() const;
     Vector3 GetUpVector() const;
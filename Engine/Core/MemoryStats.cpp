@@ -0,0 +1,103 @@
+#include "MemoryStats.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+// Static member initialization (constant-initialized: safe for allocations made
+// during static initialization)
+std::atomic<bool> FMemoryStats::bTrackAllocations{false};
+std::atomic<uint64_t> FMemoryStats::AllocationCount{0};
+std::atomic<uint64_t> FMemoryStats::FreeCount{0};
+std::atomic<uint64_t> FMemoryStats::AllocatedBytes{0};
+
+FMemorySnapshot FMemoryStats::GetSnapshot() {
+    FMemorySnapshot snapshot;
+    snapshot.allocationCount = AllocationCount.load(std::memory_order_relaxed);
+    snapshot.freeCount = FreeCount.load(std::memory_order_relaxed);
+    snapshot.allocatedBytes = AllocatedBytes.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+uint64_t FMemoryStats::GetPeakResidentBytes() {
+#if defined(__linux__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        return static_cast<uint64_t>(usage.ru_maxrss);          // Bytes
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;   // Kilobytes
+#endif
+    }
+#endif
+    return 0;
+}
+
+uint64_t FMemoryStats::GetCurrentResidentBytes() {
+#if defined(__linux__)
+    // /proc/self/statm: total and resident size, in pages
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (file == nullptr) {
+        return 0;
+    }
+    unsigned long long totalPages = 0;
+    unsigned long long residentPages = 0;
+    int fields = std::fscanf(file, "%llu %llu", &totalPages, &residentPages);
+    std::fclose(file);
+    if (fields == 2) {
+        return static_cast<uint64_t>(residentPages) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+// ============================================================================
+// Global operator new/delete replacement
+// ============================================================================
+//
+// The array, sized and nothrow forms of the standard library forward to these.
+
+void* operator new(std::size_t size) {
+    FMemoryStats::RecordAllocation(size);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        void* memory = std::malloc(size);
+        if (memory != nullptr) {
+            return memory;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    if (memory != nullptr) {
+        FMemoryStats::RecordFree();
+        std::free(memory);
+    }
+}
+
+void operator delete[](void* memory) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
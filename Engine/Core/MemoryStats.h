@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Process memory counters: heap allocations made through operator new and the
+// resident set size reported by the OS.
+//
+// MemoryStats.cpp replaces the global operator new/delete. Counting is off by
+// default (one relaxed atomic load per allocation); SetAllocationTracking(true)
+// turns it on, e.g. for the headless soak benchmark. Allocations made with
+// malloc or aligned operator new are not counted.
+
+struct FMemorySnapshot {
+    uint64_t allocationCount = 0;   // operator new calls while tracking
+    uint64_t freeCount = 0;         // operator delete calls (non-null) while tracking
+    uint64_t allocatedBytes = 0;    // Bytes requested while tracking
+};
+
+class FMemoryStats {
+public:
+    static void SetAllocationTracking(bool enabled) { bTrackAllocations.store(enabled, std::memory_order_relaxed); }
+    static bool IsTrackingAllocations() { return bTrackAllocations.load(std::memory_order_relaxed); }
+
+    static FMemorySnapshot GetSnapshot();
+
+    // Peak resident set size of the process (0 if the platform does not report it)
+    static uint64_t GetPeakResidentBytes();
+
+    // Current resident set size (0 if the platform does not report it)
+    static uint64_t GetCurrentResidentBytes();
+
+    // operator new/delete only
+    static void RecordAllocation(uint64_t size) {
+        if (bTrackAllocations.load(std::memory_order_relaxed)) {
+            AllocationCount.fetch_add(1, std::memory_order_relaxed);
+            AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        }
+    }
+
+    static void RecordFree() {
+        if (bTrackAllocations.load(std::memory_order_relaxed)) {
+            FreeCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    static std::atomic<bool> bTrackAllocations;
+    static std::atomic<uint64_t> AllocationCount;
+    static std::atomic<uint64_t> FreeCount;
+    static std::atomic<uint64_t> AllocatedBytes;
+};
@@ -1,5 +1,8 @@
 #include "UObject.h"
 #include "../Log.h"
+#include "../Stats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT("UObjects", STAT_UObjects, Core);
 
 // Static member initialization
 uint32_t UObject::nextUniqueId = 1;
@@ -14,10 +17,12 @@ UObject::UObject()
 {
     // Default name with ID
     name += "_" + std::to_string(uniqueId);
+    INC_DWORD_STAT(STAT_UObjects);
 }
 
 UObject::~UObject() {
     // Cleanup is handled by derived classes
+    DEC_DWORD_STAT(STAT_UObjects);
 }
 
 void UObject::AddToRoot() {
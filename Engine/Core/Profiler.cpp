@@ -0,0 +1,349 @@
+#include "Profiler.h"
+#include "Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Static member initialization
+std::atomic<bool> FProfiler::bCapturing{false};
+std::atomic<uint32_t> FProfiler::CaptureGeneration{0};
+
+// Events of one thread. Only the owning thread writes; the capture owner reads the
+// first publishedCount events once the capture has stopped. The event array (~6 MB) is
+// allocated by the first event recorded during a capture, so threads that are only
+// named (ThreadUtils::ApplyToCurrentThread) or never profiled cost no memory.
+struct FProfilerThreadBuffer {
+    explicit FProfilerThreadBuffer(uint32_t index)
+        : threadIndex(index)
+    {
+    }
+
+    std::unique_ptr<FProfileEvent[]> events;    // Owner thread only; set before publishedGeneration
+    const uint32_t threadIndex;
+    std::string threadName;                 // Guarded by the registry mutex
+
+    uint32_t generation = 0;                // Capture the events belong to (owner thread only)
+    std::atomic<uint32_t> publishedGeneration{0};
+    std::atomic<uint32_t> publishedCount{0};
+    std::atomic<uint32_t> droppedCount{0};
+    std::atomic<bool> bThreadExited{false};
+};
+
+namespace {
+
+struct FProfilerState {
+    std::mutex registryMutex;
+    std::vector<std::shared_ptr<FProfilerThreadBuffer>> threadBuffers;
+    uint32_t nextThreadIndex = 0;
+
+    // Capture settings (guarded by captureMutex)
+    std::mutex captureMutex;
+    std::string outputFile = "Engine.trace.json";
+    uint32_t framesRemaining = 0;
+    uint64_t frameNumber = 0;
+    int64_t captureStartTimestamp = 0;
+};
+
+FProfilerState& GetProfilerState() {
+    static FProfilerState state;
+    return state;
+}
+
+// Marks the buffer as orphaned when its thread exits (the registry keeps it alive)
+struct FProfilerThreadBufferHolder {
+    std::shared_ptr<FProfilerThreadBuffer> buffer;
+
+    ~FProfilerThreadBufferHolder() {
+        if (buffer) {
+            buffer->bThreadExited.store(true, std::memory_order_release);
+        }
+    }
+};
+
+int64_t GetProfilerTimestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void AppendJsonString(std::string& out, const char* text) {
+    out += '"';
+    for (const char* c = text; *c != '\0'; c++) {
+        switch (*c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                    out += escaped;
+                } else {
+                    out += *c;
+                }
+        }
+    }
+    out += '"';
+}
+
+void AppendTraceEvent(std::string& out, const char* name, const char* phase, uint32_t threadIndex,
+                      int64_t timestamp, int64_t captureStart) {
+    char buffer[128];
+    out += "{\"name\":";
+    AppendJsonString(out, name);
+    std::snprintf(buffer, sizeof(buffer), ",\"ph\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f", phase, threadIndex,
+                  static_cast<double>(timestamp - captureStart) / 1000.0);
+    out += buffer;
+}
+
+} // namespace
+
+FProfilerThreadBuffer& FProfiler::GetThreadBuffer() {
+    thread_local FProfilerThreadBufferHolder holder;
+    if (!holder.buffer) {
+        FProfilerState& state = GetProfilerState();
+        std::lock_guard<std::mutex> lock(state.registryMutex);
+        holder.buffer = std::make_shared<FProfilerThreadBuffer>(state.nextThreadIndex++);
+        state.threadBuffers.push_back(holder.buffer);
+    }
+    return *holder.buffer;
+}
+
+void FProfiler::SetCurrentThreadName(const std::string& name) {
+    FProfilerThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(GetProfilerState().registryMutex);
+    buffer.threadName = name;
+}
+
+void FProfiler::RecordEvent(FProfilerThreadBuffer& buffer, EProfileEventType type, const char* name, uint64_t frameNumber) {
+    // First event of a new capture: start over (only this thread touches the count)
+    uint32_t generation = CaptureGeneration.load(std::memory_order_acquire);
+    if (buffer.generation != generation) {
+        if (!buffer.events) {
+            buffer.events.reset(new (std::nothrow) FProfileEvent[DEFAULT_EVENTS_PER_THREAD]);
+        }
+        buffer.generation = generation;
+        buffer.publishedCount.store(0, std::memory_order_relaxed);
+        buffer.droppedCount.store(0, std::memory_order_relaxed);
+        buffer.publishedGeneration.store(generation, std::memory_order_release);
+    }
+
+    uint32_t count = buffer.publishedCount.load(std::memory_order_relaxed);
+    if (count >= DEFAULT_EVENTS_PER_THREAD || !buffer.events) {
+        buffer.droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    FProfileEvent& event = buffer.events[count];
+    event.timestamp = GetProfilerTimestamp();
+    event.name = name;
+    event.frameNumber = frameNumber;
+    event.type = static_cast<uint64_t>(type);
+    buffer.publishedCount.store(count + 1, std::memory_order_release);
+}
+
+void FProfiler::BeginEvent(const char* name) {
+    RecordEvent(GetThreadBuffer(), EProfileEventType::Begin, name, 0);
+}
+
+void FProfiler::EndEvent() {
+    RecordEvent(GetThreadBuffer(), EProfileEventType::End, nullptr, 0);
+}
+
+bool FProfiler::StartCapture(uint32_t frameCount, const std::string& outputFile) {
+    FProfilerState& state = GetProfilerState();
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    if (bCapturing.load(std::memory_order_relaxed) || frameCount == 0) {
+        return false;
+    }
+
+    state.outputFile = outputFile;
+    state.framesRemaining = frameCount;
+    state.frameNumber = 0;
+    state.captureStartTimestamp = GetProfilerTimestamp();
+
+    // Buffers of exited threads from earlier captures are no longer needed
+    {
+        std::lock_guard<std::mutex> registryLock(state.registryMutex);
+        state.threadBuffers.erase(
+            std::remove_if(state.threadBuffers.begin(), state.threadBuffers.end(),
+                           [](const std::shared_ptr<FProfilerThreadBuffer>& buffer) {
+                               return buffer->bThreadExited.load(std::memory_order_acquire);
+                           }),
+            state.threadBuffers.end());
+    }
+
+    CaptureGeneration.fetch_add(1, std::memory_order_acq_rel);
+    bCapturing.store(true, std::memory_order_release);
+
+    UE_LOG_DISPLAY(LogCategories::Core, "Profiler: capturing %u frames to %s", frameCount, outputFile.c_str());
+    return true;
+}
+
+bool FProfiler::StopCapture() {
+    FProfilerState& state = GetProfilerState();
+
+    // Holding the lock while writing keeps a new capture from resetting the buffers
+    std::lock_guard<std::mutex> lock(state.captureMutex);
+    if (!bCapturing.exchange(false, std::memory_order_acq_rel)) {
+        return false;
+    }
+    return WriteTrace(state.outputFile);
+}
+
+void FProfiler::EndFrame() {
+    if (!IsCapturing()) {
+        return;
+    }
+
+    FProfilerState& state = GetProfilerState();
+    bool bLastFrame = false;
+    uint64_t frameNumber = 0;
+    {
+        std::lock_guard<std::mutex> lock(state.captureMutex);
+        frameNumber = state.frameNumber++;
+        bLastFrame = state.framesRemaining > 0 && --state.framesRemaining == 0;
+    }
+
+    RecordEvent(GetThreadBuffer(), EProfileEventType::Frame, "Frame", frameNumber);
+
+    if (bLastFrame) {
+        StopCapture();
+    }
+}
+
+bool FProfiler::WriteTrace(const std::string& outputFile) {
+    FProfilerState& state = GetProfilerState();
+    const uint32_t generation = CaptureGeneration.load(std::memory_order_acquire);
+    const int64_t captureStart = state.captureStartTimestamp;
+
+    // Snapshot the buffers; events published after this point are ignored
+    struct FThreadSnapshot {
+        std::shared_ptr<FProfilerThreadBuffer> buffer;
+        std::string threadName;
+        uint32_t eventCount;
+    };
+    std::vector<FThreadSnapshot> threads;
+    {
+        std::lock_guard<std::mutex> lock(state.registryMutex);
+        for (const auto& buffer : state.threadBuffers) {
+            if (buffer->publishedGeneration.load(std::memory_order_acquire) != generation) {
+                continue;
+            }
+            threads.push_back({ buffer, buffer->threadName, buffer->publishedCount.load(std::memory_order_acquire) });
+        }
+    }
+
+    std::string json;
+    json.reserve(1024 * 1024);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool bFirstEvent = true;
+    auto beginEvent = [&json, &bFirstEvent]() {
+        if (!bFirstEvent) {
+            json += ",\n";
+        }
+        bFirstEvent = false;
+    };
+
+    size_t totalEvents = 0;
+    uint32_t totalDropped = 0;
+
+    for (const FThreadSnapshot& thread : threads) {
+        const FProfilerThreadBuffer& buffer = *thread.buffer;
+        totalDropped += buffer.droppedCount.load(std::memory_order_relaxed);
+
+        char fallbackName[32];
+        std::snprintf(fallbackName, sizeof(fallbackName), "Thread %u", buffer.threadIndex);
+        beginEvent();
+        json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+        json += std::to_string(buffer.threadIndex);
+        json += ",\"args\":{\"name\":";
+        AppendJsonString(json, thread.threadName.empty() ? fallbackName : thread.threadName.c_str());
+        json += "}}";
+
+        // Ends without a begin (scope opened before the capture) are skipped; begins
+        // still open when the capture stopped are closed at the last timestamp
+        std::vector<const char*> openScopes;
+        int64_t lastTimestamp = captureStart;
+
+        for (uint32_t i = 0; i < thread.eventCount; i++) {
+            const FProfileEvent& event = buffer.events[i];
+            lastTimestamp = std::max(lastTimestamp, event.timestamp);
+
+            switch (static_cast<EProfileEventType>(event.type)) {
+                case EProfileEventType::Begin:
+                    openScopes.push_back(event.name);
+                    beginEvent();
+                    AppendTraceEvent(json, event.name, "B", buffer.threadIndex, event.timestamp, captureStart);
+                    json += '}';
+                    break;
+                case EProfileEventType::End:
+                    if (openScopes.empty()) {
+                        continue;
+                    }
+                    beginEvent();
+                    AppendTraceEvent(json, openScopes.back(), "E", buffer.threadIndex, event.timestamp, captureStart);
+                    json += '}';
+                    openScopes.pop_back();
+                    break;
+                case EProfileEventType::Frame:
+                    beginEvent();
+                    AppendTraceEvent(json, event.name, "i", buffer.threadIndex, event.timestamp, captureStart);
+                    json += ",\"s\":\"g\",\"args\":{\"frame\":";
+                    json += std::to_string(static_cast<uint64_t>(event.frameNumber));
+                    json += "}}";
+                    break;
+            }
+            totalEvents++;
+        }
+
+        while (!openScopes.empty()) {
+            beginEvent();
+            AppendTraceEvent(json, openScopes.back(), "E", buffer.threadIndex, lastTimestamp, captureStart);
+            json += '}';
+            openScopes.pop_back();
+        }
+    }
+
+    json += "\n]}\n";
+
+    std::ofstream file(outputFile, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file.is_open()) {
+        UE_LOG_ERROR(LogCategories::Core, "Profiler: could not create %s", outputFile.c_str());
+        return false;
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+
+    UE_LOG_DISPLAY(LogCategories::Core, "Profiler: wrote %zu events from %zu threads to %s (%u dropped)",
+                   totalEvents, threads.size(), outputFile.c_str(), totalDropped);
+    return true;
+}
+
+void FProfiler::ParseCommandLine(int argc, char* argv[]) {
+    static const char FRAMES_OPTION[] = "-Profile=";
+    static const char FILE_OPTION[] = "-ProfileFile=";
+
+    uint32_t frameCount = 0;
+    std::string outputFile = "Engine.trace.json";
+    for (int i = 1; i < argc; i++) {
+        if (argv[i] == nullptr) {
+            continue;
+        }
+        if (std::strncmp(argv[i], FRAMES_OPTION, sizeof(FRAMES_OPTION) - 1) == 0) {
+            frameCount = static_cast<uint32_t>(std::strtoul(argv[i] + sizeof(FRAMES_OPTION) - 1, nullptr, 10));
+        } else if (std::strncmp(argv[i], FILE_OPTION, sizeof(FILE_OPTION) - 1) == 0) {
+            outputFile = argv[i] + sizeof(FILE_OPTION) - 1;
+        }
+    }
+
+    if (frameCount > 0) {
+        StartCapture(frameCount, outputFile);
+    }
+}
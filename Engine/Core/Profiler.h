@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Instrumentation profiler (similar to UE5's named events / Insights CPU trace)
+//
+// PROFILE_SCOPE("Name") records a begin event when the scope opens and an end
+// event when it closes, into a buffer owned by the calling thread (no locks, no
+// shared cache lines). Nothing is recorded outside a capture: the disabled cost
+// is one relaxed atomic load. A capture covers N frames (counted by
+// FProfiler::EndFrame) and is then written as Chrome trace JSON, which loads in
+// chrome://tracing and https://ui.perfetto.dev.
+//
+// Scope names must outlive the capture (string literals): only the pointer is stored.
+
+// Set to 0 to compile every PROFILE_SCOPE out
+#ifndef ENGINE_PROFILER_ENABLED
+#define ENGINE_PROFILER_ENABLED 1
+#endif
+
+enum class EProfileEventType : uint8_t {
+    Begin,
+    End,
+    Frame      // Frame boundary (instant event)
+};
+
+struct FProfileEvent {
+    int64_t timestamp;          // Nanoseconds (steady clock)
+    const char* name;
+    uint64_t frameNumber : 56;  // Frame events: number of the frame that ended
+    uint64_t type : 8;          // EProfileEventType
+};
+
+struct FProfilerThreadBuffer;
+
+class FProfiler {
+public:
+    // Events each thread can record per capture (more are dropped)
+    static constexpr uint32_t DEFAULT_EVENTS_PER_THREAD = 256 * 1024;
+
+    // Start capturing the next frameCount frames; the trace is written to outputFile
+    // when the last one ends. Returns false if a capture is already running.
+    static bool StartCapture(uint32_t frameCount, const std::string& outputFile = "Engine.trace.json");
+
+    // Stop the current capture now and write what was recorded
+    static bool StopCapture();
+
+    static bool IsCapturing() { return bCapturing.load(std::memory_order_relaxed); }
+
+    // Mark the end of a frame (call once per frame from the thread that drives
+    // frames: the game thread, or the main loop without ThreadManager)
+    static void EndFrame();
+
+    // -Profile=N (capture N frames from startup) and -ProfileFile=path
+    static void ParseCommandLine(int argc, char* argv[]);
+
+    // Name shown for the calling thread in the trace (ThreadUtils::ApplyToCurrentThread sets it)
+    static void SetCurrentThreadName(const std::string& name);
+
+    static void BeginEvent(const char* name);
+    static void EndEvent();
+
+private:
+    static FProfilerThreadBuffer& GetThreadBuffer();
+    static void RecordEvent(FProfilerThreadBuffer& buffer, EProfileEventType type, const char* name, uint64_t frameNumber);
+    static bool WriteTrace(const std::string& outputFile);
+
+    static std::atomic<bool> bCapturing;
+    static std::atomic<uint32_t> CaptureGeneration;
+};
+
+// RAII scope event. Records its end only if its begin was recorded, so a capture
+// starting or stopping mid-scope never produces unbalanced events from this thread.
+class FProfileScope {
+public:
+    explicit FProfileScope(const char* name)
+        : bRecorded(FProfiler::IsCapturing())
+    {
+        if (bRecorded) {
+            FProfiler::BeginEvent(name);
+        }
+    }
+
+    ~FProfileScope() {
+        if (bRecorded) {
+            FProfiler::EndEvent();
+        }
+    }
+
+    FProfileScope(const FProfileScope&) = delete;
+    FProfileScope& operator=(const FProfileScope&) = delete;
+
+private:
+    bool bRecorded;
+};
+
+#define PROFILE_CONCAT_INNER(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_INNER(A, B)
+
+#if ENGINE_PROFILER_ENABLED
+#define PROFILE_SCOPE(Name) FProfileScope PROFILE_CONCAT(_profileScope, __LINE__)(Name)
+#else
+#define PROFILE_SCOPE(Name) do { } while (0)
+#endif
@@ -0,0 +1,146 @@
+#include "Stats.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+// Static member initialization
+std::atomic<int64_t> FStats::AccumulatorValues[FStats::MAX_STATS] = {};
+std::atomic<uint64_t> FStats::FrameNumber{0};
+
+namespace {
+
+struct FStatRegistry {
+    std::mutex mutex;
+    FStatDescriptor* stats[FStats::MAX_STATS] = {};
+    uint32_t statCount = 0;
+
+    // Blocks outlive their threads: the last values of a thread that exited are
+    // still folded into the next frame
+    std::vector<std::unique_ptr<FStatThreadBlock>> threadBlocks;
+
+    // Moving averages, indexed like stats (AdvanceFrame only)
+    double averages[FStats::MAX_STATS] = {};
+
+    std::mutex snapshotMutex;
+    std::vector<FStatValue> snapshot;
+};
+
+FStatRegistry& GetStatRegistry() {
+    static FStatRegistry registry;
+    return registry;
+}
+
+// Frames over which FStatValue::average is smoothed
+constexpr double STAT_AVERAGE_FRAMES = 32.0;
+
+} // namespace
+
+FStatDescriptor::FStatDescriptor(const char* name, const char* group, EStatType type, EStatUnit unit)
+    : name(name)
+    , group(group)
+    , type(type)
+    , unit(unit)
+    , index(INVALID_INDEX)
+{
+    index = FStats::RegisterStat(*this);
+}
+
+uint32_t FStats::RegisterStat(FStatDescriptor& stat) {
+    FStatRegistry& registry = GetStatRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (registry.statCount >= MAX_STATS) {
+        // Static initialization: the log may not be up yet
+        std::fprintf(stderr, "Stats: too many stats, '%s' will not be recorded\n", stat.GetName());
+        return FStatDescriptor::INVALID_INDEX;
+    }
+
+    uint32_t index = registry.statCount++;
+    registry.stats[index] = &stat;
+    return index;
+}
+
+FStatThreadBlock* FStats::CreateThreadBlock() {
+    FStatRegistry& registry = GetStatRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threadBlocks.push_back(std::make_unique<FStatThreadBlock>());
+    return registry.threadBlocks.back().get();
+}
+
+void FStats::AdvanceFrame() {
+    FStatRegistry& registry = GetStatRegistry();
+    std::vector<FStatValue> frameValues;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        const bool bFirstFrame = FrameNumber.load(std::memory_order_relaxed) == 0;
+        frameValues.reserve(registry.statCount);
+
+        for (uint32_t index = 0; index < registry.statCount; index++) {
+            const FStatDescriptor& stat = *registry.stats[index];
+            double value = 0.0;
+            uint64_t callCount = 0;
+
+            if (stat.GetType() == EStatType::Accumulator) {
+                value = static_cast<double>(AccumulatorValues[index].load(std::memory_order_relaxed));
+            } else {
+                // Sum what every thread added since the previous frame
+                int64_t delta = 0;
+                for (auto& block : registry.threadBlocks) {
+                    int64_t current = block->values[index].load(std::memory_order_relaxed);
+                    uint32_t currentCalls = block->calls[index].load(std::memory_order_relaxed);
+                    delta += current - block->lastValues[index];
+                    callCount += currentCalls - block->lastCalls[index];
+                    block->lastValues[index] = current;
+                    block->lastCalls[index] = currentCalls;
+                }
+                value = stat.GetType() == EStatType::Cycle ? static_cast<double>(delta) / 1000000.0
+                                                           : static_cast<double>(delta);
+            }
+
+            double& average = registry.averages[index];
+            average = bFirstFrame ? value : average + (value - average) / STAT_AVERAGE_FRAMES;
+
+            frameValues.push_back({stat.GetName(), stat.GetGroup(), stat.GetType(), stat.GetUnit(),
+                                   value, average, callCount});
+        }
+    }
+
+    std::sort(frameValues.begin(), frameValues.end(), [](const FStatValue& a, const FStatValue& b) {
+        int groupOrder = std::strcmp(a.group, b.group);
+        return groupOrder != 0 ? groupOrder < 0 : std::strcmp(a.name, b.name) < 0;
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(registry.snapshotMutex);
+        registry.snapshot.swap(frameValues);
+    }
+    FrameNumber.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<FStatValue> FStats::GetFrameSnapshot() {
+    FStatRegistry& registry = GetStatRegistry();
+    std::lock_guard<std::mutex> lock(registry.snapshotMutex);
+    return registry.snapshot;
+}
+
+std::string FStats::FormatValue(const FStatValue& stat) {
+    char buffer[64];
+    if (stat.type == EStatType::Cycle) {
+        std::snprintf(buffer, sizeof(buffer), "%.3f ms (%llu calls)", stat.average,
+                      static_cast<unsigned long long>(stat.callCount));
+    } else if (stat.unit == EStatUnit::Bytes) {
+        if (stat.average >= 1024.0 * 1024.0) {
+            std::snprintf(buffer, sizeof(buffer), "%.2f MB", stat.average / (1024.0 * 1024.0));
+        } else if (stat.average >= 1024.0) {
+            std::snprintf(buffer, sizeof(buffer), "%.1f KB", stat.average / 1024.0);
+        } else {
+            std::snprintf(buffer, sizeof(buffer), "%.0f B", stat.average);
+        }
+    } else if (stat.type == EStatType::Accumulator) {
+        std::snprintf(buffer, sizeof(buffer), "%.0f", stat.value);
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%.1f", stat.average);
+    }
+    return buffer;
+}
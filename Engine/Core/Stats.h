@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Profiler.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Named stats (similar to UE5's stat system: DECLARE_CYCLE_STAT, INC_DWORD_STAT...)
+//
+// Stats are declared once at file scope and registered at static initialization:
+//
+//   DECLARE_CYCLE_STAT("Draw frame", STAT_DrawFrame, RHI);
+//   DECLARE_DWORD_COUNTER_STAT("Draw calls", STAT_DrawCalls, RHI);
+//
+//   SCOPE_CYCLE_COUNTER(STAT_DrawFrame);
+//   INC_DWORD_STAT(STAT_DrawCalls);
+//
+// Cycle and counter stats add into a block owned by the calling thread (plain
+// relaxed stores, no locks, no shared cache lines). FStats::AdvanceFrame sums the
+// per-thread deltas once per frame into a snapshot that StatsPanel and DebugOverlay
+// list, so a new stat shows up without UI code. Accumulator stats (values that
+// persist across frames, e.g. live object counts) live in one shared atomic each.
+
+// Set to 0 to compile every stat macro out
+#ifndef ENGINE_STATS_ENABLED
+#define ENGINE_STATS_ENABLED 1
+#endif
+
+enum class EStatType : uint8_t {
+    Cycle,          // Time spent in SCOPE_CYCLE_COUNTER scopes per frame
+    Counter,        // Reset every frame (draw calls, commands executed...)
+    Accumulator     // Kept across frames (live objects...)
+};
+
+enum class EStatUnit : uint8_t {
+    Count,
+    Bytes
+};
+
+// Aggregated value of a stat for the last frame
+struct FStatValue {
+    const char* name;
+    const char* group;
+    EStatType type;
+    EStatUnit unit;
+    double value;       // Cycle stats: milliseconds; others: count or bytes
+    double average;     // Moving average over ~32 frames
+    uint64_t callCount; // Cycle stats: scopes closed during the frame
+};
+
+class FStatDescriptor {
+public:
+    FStatDescriptor(const char* name, const char* group, EStatType type, EStatUnit unit = EStatUnit::Count);
+
+    const char* GetName() const { return name; }
+    const char* GetGroup() const { return group; }
+    EStatType GetType() const { return type; }
+    EStatUnit GetUnit() const { return unit; }
+
+    // Slot in the per-thread blocks (INVALID_INDEX if the registry was full)
+    uint32_t GetIndex() const { return index; }
+
+    static constexpr uint32_t INVALID_INDEX = ~0u;
+
+private:
+    const char* name;
+    const char* group;
+    EStatType type;
+    EStatUnit unit;
+    uint32_t index;
+};
+
+// Values of one thread. Only the owning thread writes them; AdvanceFrame reads them
+// and remembers what it saw to compute the per-frame deltas.
+struct FStatThreadBlock {
+    static constexpr uint32_t MAX_STATS = 256;
+
+    std::atomic<int64_t> values[MAX_STATS] = {};
+    std::atomic<uint32_t> calls[MAX_STATS] = {};
+
+    // AdvanceFrame only
+    int64_t lastValues[MAX_STATS] = {};
+    uint32_t lastCalls[MAX_STATS] = {};
+};
+
+class FStats {
+public:
+    static constexpr uint32_t MAX_STATS = FStatThreadBlock::MAX_STATS;
+
+    // Aggregate the values recorded since the previous call into the frame snapshot.
+    // Call once per frame from the thread that drives frames.
+    static void AdvanceFrame();
+
+    // Last aggregated frame, sorted by group and name (safe from any thread)
+    static std::vector<FStatValue> GetFrameSnapshot();
+    static uint64_t GetFrameNumber() { return FrameNumber.load(std::memory_order_relaxed); }
+
+    // "1.25 ms (3 calls)", "12.4 KB", "42"
+    static std::string FormatValue(const FStatValue& stat);
+
+    static void AddValue(const FStatDescriptor& stat, int64_t amount) {
+        uint32_t index = stat.GetIndex();
+        if (index >= MAX_STATS) {
+            return;
+        }
+        if (stat.GetType() == EStatType::Accumulator) {
+            AccumulatorValues[index].fetch_add(amount, std::memory_order_relaxed);
+            return;
+        }
+        std::atomic<int64_t>& value = GetThreadBlock().values[index];
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    // Accumulator stats only
+    static void SetValue(const FStatDescriptor& stat, int64_t value) {
+        uint32_t index = stat.GetIndex();
+        if (index < MAX_STATS && stat.GetType() == EStatType::Accumulator) {
+            AccumulatorValues[index].store(value, std::memory_order_relaxed);
+        }
+    }
+
+    static void AddCycles(const FStatDescriptor& stat, int64_t nanoseconds) {
+        uint32_t index = stat.GetIndex();
+        if (index >= MAX_STATS) {
+            return;
+        }
+        FStatThreadBlock& block = GetThreadBlock();
+        block.values[index].store(block.values[index].load(std::memory_order_relaxed) + nanoseconds,
+                                  std::memory_order_relaxed);
+        block.calls[index].store(block.calls[index].load(std::memory_order_relaxed) + 1,
+                                 std::memory_order_relaxed);
+    }
+
+private:
+    friend class FStatDescriptor;
+    static uint32_t RegisterStat(FStatDescriptor& stat);
+
+    static FStatThreadBlock& GetThreadBlock() {
+        thread_local FStatThreadBlock* block = nullptr;
+        if (block == nullptr) {
+            block = CreateThreadBlock();
+        }
+        return *block;
+    }
+    static FStatThreadBlock* CreateThreadBlock();
+
+    static std::atomic<int64_t> AccumulatorValues[MAX_STATS];
+    static std::atomic<uint64_t> FrameNumber;
+};
+
+// RAII cycle counter. Also shows up as a profiler scope while a capture runs.
+class FScopeCycleCounter {
+public:
+    explicit FScopeCycleCounter(const FStatDescriptor& stat)
+        : stat(stat)
+        , profileScope(stat.GetName())
+        , startTime(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~FScopeCycleCounter() {
+        auto elapsed = std::chrono::steady_clock::now() - startTime;
+        FStats::AddCycles(stat, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    FScopeCycleCounter(const FScopeCycleCounter&) = delete;
+    FScopeCycleCounter& operator=(const FScopeCycleCounter&) = delete;
+
+private:
+    const FStatDescriptor& stat;
+    FProfileScope profileScope;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+#if ENGINE_STATS_ENABLED
+
+// GroupName is an identifier (RHI, UI, Core...), stringized like log category names
+#define DECLARE_CYCLE_STAT(CounterName, StatId, GroupName) \
+    static FStatDescriptor StatId(CounterName, #GroupName, EStatType::Cycle)
+#define DECLARE_DWORD_COUNTER_STAT(CounterName, StatId, GroupName) \
+    static FStatDescriptor StatId(CounterName, #GroupName, EStatType::Counter)
+#define DECLARE_DWORD_ACCUMULATOR_STAT(CounterName, StatId, GroupName) \
+    static FStatDescriptor StatId(CounterName, #GroupName, EStatType::Accumulator)
+#define DECLARE_MEMORY_COUNTER_STAT(CounterName, StatId, GroupName) \
+    static FStatDescriptor StatId(CounterName, #GroupName, EStatType::Counter, EStatUnit::Bytes)
+
+#define SCOPE_CYCLE_COUNTER(StatId) FScopeCycleCounter PROFILE_CONCAT(_cycleCounter, __LINE__)(StatId)
+
+#define INC_DWORD_STAT(StatId) FStats::AddValue(StatId, 1)
+#define INC_DWORD_STAT_BY(StatId, Amount) FStats::AddValue(StatId, static_cast<int64_t>(Amount))
+#define DEC_DWORD_STAT(StatId) FStats::AddValue(StatId, -1)
+#define SET_DWORD_STAT(StatId, Value) FStats::SetValue(StatId, static_cast<int64_t>(Value))
+#define INC_MEMORY_STAT_BY(StatId, Bytes) FStats::AddValue(StatId, static_cast<int64_t>(Bytes))
+
+#else
+
+#define DECLARE_CYCLE_STAT(CounterName, StatId, GroupName)
+#define DECLARE_DWORD_COUNTER_STAT(CounterName, StatId, GroupName)
+#define DECLARE_DWORD_ACCUMULATOR_STAT(CounterName, StatId, GroupName)
+#define DECLARE_MEMORY_COUNTER_STAT(CounterName, StatId, GroupName)
+
+#define SCOPE_CYCLE_COUNTER(StatId) do { } while (0)
+#define INC_DWORD_STAT(StatId) do { } while (0)
+#define INC_DWORD_STAT_BY(StatId, Amount) do { } while (0)
+#define DEC_DWORD_STAT(StatId) do { } while (0)
+#define SET_DWORD_STAT(StatId, Value) do { } while (0)
+#define INC_MEMORY_STAT_BY(StatId, Bytes) do { } while (0)
+
+#endif
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "MPSCRingBuffer.h"
+#include "../Log.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// TCommandQueue - Cola de comandos multi-producer / single-consumer
+// Base común de RenderCommandQueue y de la cola de tareas del game thread.
+//
+// Camino rápido: ring buffer lock-free (TMPSCRingBuffer) cuyas celdas contienen
+// el comando con su lambda inline; ExecuteAll los ejecuta y destruye in-place
+// recorriendo el ring secuencialmente. Si el ring se llena, los comandos pasan a
+// una cola de overflow con mutex hasta que el consumidor la vacía, preservando
+// el orden FIFO de cada productor.
+//
+// CommandType debe ser default-constructible, movible y ofrecer
+// Emplace(...), IsBound(), Execute() y Reset().
+// ============================================================================
+
+template<typename CommandType>
+class TCommandQueue {
+    // Mover un comando a una celda ya reclamada no puede fallar (ver TMPSCRingBuffer::TryPushWith)
+    static_assert(std::is_nothrow_move_assignable<CommandType>::value,
+                  "TCommandQueue: CommandType must be nothrow move-assignable");
+
+public:
+    explicit TCommandQueue(size_t capacity) : commandRing(capacity) {}
+
+    TCommandQueue(const TCommandQueue&) = delete;
+    TCommandQueue& operator=(const TCommandQueue&) = delete;
+
+    // Encolar (cualquier thread). Devuelve false tras Shutdown().
+    // Si CommandType::Emplace(args...) es noexcept, el comando se construye directamente
+    // sobre la celda del ring. Si puede lanzar (copia del lambda que lanza, lambda que no
+    // cabe inline), se construye antes de reclamar la celda: una excepción sale de Enqueue
+    // sin dejar en el ring una celda reclamada que el consumidor esperaría para siempre.
+    template<typename... ArgTypes>
+    bool Enqueue(ArgTypes&&... args) {
+        if (bShutdown.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        if constexpr (noexcept(std::declval<CommandType&>().Emplace(std::forward<ArgTypes>(args)...))) {
+            if (!bOverflowActive.load(std::memory_order_acquire) &&
+                commandRing.TryPushWith([&](CommandType& slot) noexcept {
+                    slot.Emplace(std::forward<ArgTypes>(args)...);
+                })) {
+                bWakePending.store(true, std::memory_order_release);
+                return true;
+            }
+        }
+
+        CommandType command;
+        command.Emplace(std::forward<ArgTypes>(args)...);
+        return EnqueueCommand(std::move(command));
+    }
+
+    // Encolar un comando ya construido
+    bool EnqueueCommand(CommandType&& command) {
+        if (bShutdown.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        // Mientras haya overflow pendiente, seguir encolando ahí para no adelantar
+        // comandos del mismo productor
+        if (!bOverflowActive.load(std::memory_order_acquire) &&
+            commandRing.TryPushWith([&command](CommandType& slot) noexcept { slot = std::move(command); })) {
+            bWakePending.store(true, std::memory_order_release);
+            return true;
+        }
+
+        EnqueueOverflow(std::move(command));
+        return true;
+    }
+
+    // Encolar 'count' comandos ya construidos, en orden y contiguos en el ring:
+    // una sola operación atómica para todo el lote. Si no caben, se encolan uno a
+    // uno (ring y luego overflow) conservando el orden. Los comandos quedan movidos.
+    bool EnqueueCommands(CommandType* commands, size_t count) {
+        if (bShutdown.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        if (count == 0) {
+            return true;
+        }
+
+        if (!bOverflowActive.load(std::memory_order_acquire) &&
+            commandRing.TryPushRange(count, [commands](size_t index, CommandType& slot) noexcept {
+                slot = std::move(commands[index]);
+            })) {
+            bWakePending.store(true, std::memory_order_release);
+            return true;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            EnqueueCommand(std::move(commands[i]));
+        }
+        return true;
+    }
+
+    // Ejecutar lo encolado hasta ahora (consumidor). Si otro thread ya está
+    // consumiendo, retorna 0 sin hacer nada. Devuelve el número de comandos ejecutados.
+    size_t ExecuteAll() {
+        return ExecuteAll([](size_t) {});
+    }
+
+    // Igual, llamando onBatchComplete(commandCount) al terminar la pasada, todavía
+    // como único consumidor (para publicar estado del consumidor sin locks)
+    template<typename BatchCallbackType>
+    size_t ExecuteAll(BatchCallbackType&& onBatchComplete) {
+        if (bConsumerActive.exchange(true, std::memory_order_acquire)) {
+            return 0;
+        }
+
+        // Si un comando lanza algo que no es std::exception, la excepción sale de ExecuteAll:
+        // liberar el consumidor igualmente
+        struct FConsumerGuard {
+            std::atomic<bool>& bActive;
+            ~FConsumerGuard() { bActive.store(false, std::memory_order_release); }
+        } consumerGuard{bConsumerActive};
+
+        size_t commandCount = 0;
+
+        // pendingCommands solo conserva comandos si una pasada anterior terminó con una
+        // excepción: se ejecutan primero (los ya ejecutados quedaron sin lambda y se saltan)
+        if (!bOverflowActive.load(std::memory_order_acquire) && pendingCommands.empty()) {
+            // Camino rápido: ejecutar in-place recorriendo el ring, sin mover ni reservar.
+            // Solo lo encolado antes de empezar (los comandos que encolan comandos esperan a la siguiente pasada).
+            const size_t claimedCount = commandRing.GetClaimedCount();
+            while (commandRing.GetConsumedCount() < claimedCount &&
+                   commandRing.TryConsume(ExecuteAndReset)) {
+                commandCount++;
+            }
+        } else {
+            // Hay overflow: extraer respetando el orden y ejecutar fuera del lock
+            DrainCommands(pendingCommands);
+            for (auto& command : pendingCommands) {
+                ExecuteAndReset(command);
+                commandCount++;
+            }
+            pendingCommands.clear();
+        }
+
+        onBatchComplete(commandCount);
+        return commandCount;
+    }
+
+    // Ejecutar hasta que la cola quede vacía
+    size_t ExecuteUntilEmpty() {
+        size_t commandCount = 0;
+        while (!IsEmpty()) {
+            commandCount += ExecuteAll();
+        }
+        return commandCount;
+    }
+
+    // Descartar todos los comandos pendientes sin ejecutarlos
+    void Clear() {
+        // Esperar a que termine el consumidor actual
+        while (bConsumerActive.exchange(true, std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+
+        std::vector<CommandType> discarded;
+        DrainCommands(discarded);
+        pendingCommands.clear();
+
+        bConsumerActive.store(false, std::memory_order_release);
+    }
+
+    // Tamaño (aproximado mientras haya productores activos)
+    size_t Size() const {
+        size_t size = commandRing.SizeApprox();
+        if (bOverflowActive.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(overflowMutex);
+            size += overflowQueue.size();
+        }
+        return size;
+    }
+
+    // Lock-free
+    bool IsEmpty() const {
+        return commandRing.IsEmptyApprox() && !bOverflowActive.load(std::memory_order_acquire);
+    }
+
+    // Bloquear hasta que haya comandos o Shutdown()
+    void WaitForCommands() {
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeCondition.wait(lock, [this] {
+            return !IsEmpty() || bShutdown;
+        });
+    }
+
+    // Despertar al consumidor si se encoló algo desde la última notificación.
+    // Pensado para llamarse una vez por frame desde el productor.
+    void NotifyCommandsAvailable() {
+        if (!bWakePending.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+
+        // Tomar el mutex evita perder el wakeup si el consumidor está evaluando el predicado
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        wakeCondition.notify_one();
+    }
+
+    // Rechazar nuevos comandos, despertar al consumidor y descartar lo pendiente
+    void Shutdown() {
+        bShutdown = true;
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        wakeCondition.notify_all();
+        Clear();
+    }
+
+    bool IsShutdown() const { return bShutdown; }
+
+private:
+    // Ejecutar un comando y destruir su lambda (la celda queda lista para reutilizarse)
+    static void ExecuteAndReset(CommandType& command) {
+        if (command.IsBound()) {
+            try {
+                command.Execute();
+            } catch (const std::exception& e) {
+                UE_LOG_ERROR(LogCategories::Core, "Exception in queued command: %s", e.what());
+            } catch (...) {
+                // Destruir la lambda antes de propagar: la celda del ring queda sin consumir y
+                // la siguiente pasada la libera sin volver a ejecutarla
+                command.Reset();
+                throw;
+            }
+        }
+        command.Reset();
+    }
+
+    // Camino lento: ring lleno o overflow pendiente
+    void EnqueueOverflow(CommandType&& command) {
+        {
+            std::lock_guard<std::mutex> lock(overflowMutex);
+            overflowQueue.push_back(std::move(command));
+            bOverflowActive.store(true, std::memory_order_release);
+        }
+        bWakePending.store(true, std::memory_order_release);
+    }
+
+    // Mover todos los comandos pendientes a 'out' en orden de ejecución (solo consumidor)
+    void DrainCommands(std::vector<CommandType>& out) {
+        auto moveOut = [&out](CommandType& slot) { out.push_back(std::move(slot)); };
+
+        if (!bOverflowActive.load(std::memory_order_acquire)) {
+            // Sin overflow: vaciar el ring hasta la primera celda no publicada
+            while (commandRing.TryConsume(moveOut)) {
+            }
+            return;
+        }
+
+        // Con overflow: bajo el lock ningún productor puede añadir al overflow.
+        // Primero todo lo reclamado en el ring (es anterior a lo que está en overflow),
+        // luego el overflow, y solo entonces volver al camino rápido.
+        std::lock_guard<std::mutex> lock(overflowMutex);
+
+        const size_t claimedCount = commandRing.GetClaimedCount();
+        while (commandRing.GetConsumedCount() < claimedCount) {
+            if (!commandRing.TryConsume(moveOut)) {
+                // Un productor reclamó la celda pero aún no terminó de escribirla
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto& overflowCommand : overflowQueue) {
+            out.push_back(std::move(overflowCommand));
+        }
+        overflowQueue.clear();
+
+        bOverflowActive.store(false, std::memory_order_release);
+    }
+
+    // Camino rápido: ring buffer lock-free
+    TMPSCRingBuffer<CommandType> commandRing;
+
+    // Camino lento: overflow cuando el ring está lleno
+    mutable std::mutex overflowMutex;
+    std::deque<CommandType> overflowQueue;
+    std::atomic<bool> bOverflowActive{false};
+
+    // Garantiza un único consumidor a la vez
+    std::atomic<bool> bConsumerActive{false};
+
+    // Comandos extraídos cuando hay overflow (reutilizado entre pasadas, solo consumidor)
+    std::vector<CommandType> pendingCommands;
+
+    // Despertar del consumidor (batched por frame)
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::atomic<bool> bWakePending{false};
+    std::atomic<bool> bShutdown{false};
+};
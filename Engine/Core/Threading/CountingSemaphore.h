@@ -0,0 +1,81 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+// ============================================================================
+// FCountingSemaphore - Semáforo contador (C++17 no tiene std::counting_semaphore)
+// Pensado para sincronización por frame (pocas operaciones por segundo).
+// ============================================================================
+
+class FCountingSemaphore {
+public:
+    explicit FCountingSemaphore(int32_t initialCount = 0) : count(initialCount) {}
+
+    FCountingSemaphore(const FCountingSemaphore&) = delete;
+    FCountingSemaphore& operator=(const FCountingSemaphore&) = delete;
+
+    // Bloquear hasta poder decrementar
+    void Acquire() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return count > 0; });
+        count--;
+    }
+
+    // Bloquear hasta poder decrementar o hasta que wakePredicate() sea true.
+    // Devuelve true si se decrementó. wakePredicate se evalúa con el mutex tomado;
+    // quien lo vuelva true debe llamar WakeWaiters().
+    template<typename PredicateType>
+    bool AcquireUnless(PredicateType&& wakePredicate) {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&] { return count > 0 || wakePredicate(); });
+        if (count > 0) {
+            count--;
+            return true;
+        }
+        return false;
+    }
+
+    // Despertar a los threads bloqueados en AcquireUnless sin incrementar
+    void WakeWaiters() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        condition.notify_all();
+    }
+
+    // Decrementar si es posible, sin bloquear
+    bool TryAcquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count > 0) {
+            count--;
+            return true;
+        }
+        return false;
+    }
+
+    // Incrementar y despertar a los threads que esperan
+    void Release(int32_t amount = 1) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            count += amount;
+        }
+        if (amount == 1) {
+            condition.notify_one();
+        } else {
+            condition.notify_all();
+        }
+    }
+
+    // Reiniciar el contador (solo sin threads esperando)
+    void Reset(int32_t newCount) {
+        std::lock_guard<std::mutex> lock(mutex);
+        count = newCount;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable condition;
+    int32_t count;
+};
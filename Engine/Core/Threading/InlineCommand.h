@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// FInlineCommand - Callable void() con almacenamiento inline y type-erasure manual
+// El lambda se construye in-place (placement new) dentro del propio objeto, así que
+// encolarlo en un ring buffer no reserva memoria. Solo los lambdas que no caben en
+// INLINE_SIZE (o no son nothrow-movibles) van al heap.
+// ============================================================================
+
+struct alignas(16) FInlineCommand {
+    // 80 bytes (antes 96): así un FRenderCommand (tipo + comando) más el número de
+    // secuencia ocupa exactamente 2 líneas de caché por celda del ring, no 3
+    static constexpr size_t INLINE_SIZE = 80;
+    static constexpr size_t INLINE_ALIGNMENT = 16;
+
+    FInlineCommand() = default;
+
+    template<typename LambdaType,
+             typename = std::enable_if_t<!std::is_same<std::decay_t<LambdaType>, FInlineCommand>::value>>
+    explicit FInlineCommand(LambdaType&& lambda) {
+        Emplace(std::forward<LambdaType>(lambda));
+    }
+
+    FInlineCommand(FInlineCommand&& other) noexcept { MoveFrom(other); }
+
+    FInlineCommand& operator=(FInlineCommand&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    FInlineCommand(const FInlineCommand&) = delete;
+    FInlineCommand& operator=(const FInlineCommand&) = delete;
+
+    ~FInlineCommand() { Reset(); }
+
+    // Construir el lambda dentro del comando (destruye el anterior si había uno).
+    // noexcept si el lambda cabe inline y construirlo no lanza (ver IsNothrowEmplaceable)
+    template<typename LambdaType>
+    void Emplace(LambdaType&& lambda) noexcept(IsNothrowEmplaceable<LambdaType>()) {
+        using FunctorType = std::decay_t<LambdaType>;
+        Reset();
+        if constexpr (FitsInline<FunctorType>()) {
+            new (storage) FunctorType(std::forward<LambdaType>(lambda));
+            ops = &TInlineOps<FunctorType>::Ops;
+        } else {
+            *reinterpret_cast<FunctorType**>(storage) = new FunctorType(std::forward<LambdaType>(lambda));
+            ops = &THeapOps<FunctorType>::Ops;
+        }
+    }
+
+    // Emplace(lambda) no puede lanzar: ni reserva memoria ni copia/mueve con excepciones
+    template<typename LambdaType>
+    static constexpr bool IsNothrowEmplaceable() {
+        using FunctorType = std::decay_t<LambdaType>;
+        return FitsInline<FunctorType>() && std::is_nothrow_constructible<FunctorType, LambdaType&&>::value;
+    }
+
+    bool IsBound() const { return ops != nullptr; }
+
+    void Execute() { ops->Execute(storage); }
+
+    // Destruir el lambda y dejar el comando vacío
+    void Reset() {
+        if (ops) {
+            ops->Destroy(storage);
+            ops = nullptr;
+        }
+    }
+
+private:
+    struct FOps {
+        void (*Execute)(void* storage);
+        void (*Destroy)(void* storage);
+        void (*Relocate)(void* destination, void* source);  // Move + destroy source
+    };
+
+    template<typename FunctorType>
+    static constexpr bool FitsInline() {
+        return sizeof(FunctorType) <= INLINE_SIZE &&
+               alignof(FunctorType) <= INLINE_ALIGNMENT &&
+               std::is_nothrow_move_constructible<FunctorType>::value;
+    }
+
+    template<typename FunctorType>
+    struct TInlineOps {
+        static void Execute(void* storage) { (*static_cast<FunctorType*>(storage))(); }
+        static void Destroy(void* storage) { static_cast<FunctorType*>(storage)->~FunctorType(); }
+        static void Relocate(void* destination, void* source) {
+            FunctorType* sourceFunctor = static_cast<FunctorType*>(source);
+            new (destination) FunctorType(std::move(*sourceFunctor));
+            sourceFunctor->~FunctorType();
+        }
+        static constexpr FOps Ops = { &Execute, &Destroy, &Relocate };
+    };
+
+    template<typename FunctorType>
+    struct THeapOps {
+        static FunctorType*& Pointer(void* storage) { return *static_cast<FunctorType**>(storage); }
+        static void Execute(void* storage) { (*Pointer(storage))(); }
+        static void Destroy(void* storage) { delete Pointer(storage); }
+        static void Relocate(void* destination, void* source) { Pointer(destination) = Pointer(source); }
+        static constexpr FOps Ops = { &Execute, &Destroy, &Relocate };
+    };
+
+    void MoveFrom(FInlineCommand& other) {
+        ops = other.ops;
+        if (ops) {
+            ops->Relocate(storage, other.storage);
+            other.ops = nullptr;
+        }
+    }
+
+    const FOps* ops = nullptr;
+    alignas(INLINE_ALIGNMENT) unsigned char storage[INLINE_SIZE];
+};
@@ -0,0 +1,374 @@
+#include "JobSystem.h"
+#include "../Log.h"
+#include <algorithm>
+#include <string>
+
+namespace {
+
+// Índice del worker actual (-1 si el thread no es un worker)
+thread_local int32_t GWorkerIndex = -1;
+
+// Iteraciones buscando trabajo antes de dormir
+constexpr int WORKER_SPIN_COUNT = 64;
+
+// Jobs entre muestras del tiempo de CPU de un worker
+constexpr int WORKER_CPU_TIME_SAMPLE_INTERVAL = 64;
+
+// Pool de jobs del thread actual. Al terminar el thread el pool queda libre para
+// otro thread; los jobs que aún estén en vuelo vuelven a él igualmente.
+struct FThreadJobPool {
+    FJobPool* pool = nullptr;
+
+    ~FThreadJobPool() {
+        if (pool) {
+            pool->bOwned.store(false, std::memory_order_release);
+        }
+    }
+};
+thread_local FThreadJobPool GThreadJobPool;
+
+} // namespace
+
+JobSystem& JobSystem::Get() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::~JobSystem() {
+    Shutdown();
+}
+
+void JobSystem::Initialize(uint32_t numWorkers) {
+    if (bInitialized) {
+        UE_LOG_WARNING(LogCategories::Core, "JobSystem already initialized");
+        return;
+    }
+
+    if (numWorkers == 0) {
+        numWorkers = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    UE_LOG_INFO(LogCategories::Core, "Initializing JobSystem with %u worker threads...", numWorkers);
+
+    bRunning = true;
+
+    // Crear todos los deques antes de arrancar threads (los workers roban entre sí)
+    workers.reserve(numWorkers);
+    for (uint32_t i = 0; i < numWorkers; i++) {
+        workers.push_back(std::make_unique<FWorker>());
+    }
+    for (uint32_t i = 0; i < numWorkers; i++) {
+        workers[i]->thread = std::thread(&JobSystem::WorkerMain, this, i);
+    }
+
+    bInitialized = true;
+    UE_LOG_INFO(LogCategories::Core, "JobSystem initialized successfully");
+}
+
+void JobSystem::Shutdown() {
+    if (!bInitialized) {
+        return;
+    }
+
+    UE_LOG_INFO(LogCategories::Core, "Shutting down JobSystem...");
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        bRunning = false;
+    }
+    wakeCondition.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    // Ejecutar lo que quedó pendiente para no dejar handles sin completar
+    while (FJob* job = FindJob(-1)) {
+        ExecuteJob(job);
+    }
+
+    workers.clear();
+    bInitialized = false;
+    UE_LOG_INFO(LogCategories::Core, "JobSystem shutdown complete");
+}
+
+double JobSystem::GetWorkerCPUTime(uint32_t workerIndex) const {
+    if (workerIndex >= workers.size()) {
+        return 0.0;
+    }
+    return workers[workerIndex]->cpuTime.load(std::memory_order_relaxed);
+}
+
+double JobSystem::GetTotalWorkerCPUTime() const {
+    double total = 0.0;
+    for (const auto& worker : workers) {
+        total += worker->cpuTime.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+bool JobSystem::IsInWorkerThread() const {
+    return GWorkerIndex >= 0;
+}
+
+FJobHandle JobSystem::CreateHandle() {
+    return FJobHandle(std::make_shared<FJobCounter>());
+}
+
+FJobHandle JobSystem::Submit(std::function<void()> task) {
+    FJobHandle handle = CreateHandle();
+    Submit(std::move(task), handle);
+    return handle;
+}
+
+void JobSystem::Submit(std::function<void()> task, FJobHandle& handle) {
+    if (!handle.IsValid()) {
+        handle = CreateHandle();
+    }
+
+    // Sin workers: ejecutar en el thread actual
+    if (!bRunning) {
+        task();
+        return;
+    }
+
+    handle.counter->pendingJobs.fetch_add(1, std::memory_order_relaxed);
+    PushJob(AllocateJob(std::move(task), handle.counter));
+}
+
+FJobPool& JobSystem::GetThreadJobPool() {
+    if (GThreadJobPool.pool) {
+        return *GThreadJobPool.pool;
+    }
+
+    std::lock_guard<std::mutex> lock(jobPoolsMutex);
+    for (auto& pool : jobPools) {
+        if (!pool->bOwned.exchange(true, std::memory_order_acquire)) {
+            GThreadJobPool.pool = pool.get();
+            return *pool;
+        }
+    }
+    jobPools.push_back(std::make_unique<FJobPool>());
+    jobPools.back()->bOwned.store(true, std::memory_order_relaxed);
+    GThreadJobPool.pool = jobPools.back().get();
+    return *GThreadJobPool.pool;
+}
+
+FJob* JobSystem::AllocateJob(std::function<void()>&& task, std::shared_ptr<FJobCounter> counter) {
+    FJobPool& pool = GetThreadJobPool();
+
+    if (!pool.freeJobs) {
+        pool.freeJobs = pool.returnedJobs.exchange(nullptr, std::memory_order_acquire);
+    }
+    if (!pool.freeJobs) {
+        // Bloque nuevo encadenado en la lista de libres
+        std::unique_ptr<FJob[]> block(new FJob[JOB_POOL_BLOCK_SIZE]);
+        for (size_t i = 0; i < JOB_POOL_BLOCK_SIZE; i++) {
+            block[i].pool = &pool;
+            block[i].nextFree = i + 1 < JOB_POOL_BLOCK_SIZE ? &block[i + 1] : nullptr;
+        }
+        pool.freeJobs = block.get();
+        pool.blocks.push_back(std::move(block));
+    }
+
+    FJob* job = pool.freeJobs;
+    pool.freeJobs = job->nextFree;
+    job->nextFree = nullptr;
+    job->task = std::move(task);
+    job->counter = std::move(counter);
+    return job;
+}
+
+void JobSystem::ReleaseJob(FJob* job) {
+    job->task = nullptr;
+    job->counter.reset();
+
+    FJobPool* pool = job->pool;
+    if (pool == GThreadJobPool.pool) {
+        job->nextFree = pool->freeJobs;
+        pool->freeJobs = job;
+        return;
+    }
+
+    FJob* head = pool->returnedJobs.load(std::memory_order_relaxed);
+    do {
+        job->nextFree = head;
+    } while (!pool->returnedJobs.compare_exchange_weak(head, job, std::memory_order_release,
+                                                       std::memory_order_relaxed));
+}
+
+void JobSystem::PushJob(FJob* job) {
+    bool bPushed = false;
+    if (GWorkerIndex >= 0 && GWorkerIndex < static_cast<int32_t>(workers.size())) {
+        bPushed = workers[GWorkerIndex]->deque.Push(job);
+        if (!bPushed) {
+            // Deque lleno: ejecutar inline en vez de bloquear
+            ExecuteJob(job);
+            return;
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(globalQueueMutex);
+        globalQueue.push_back(job);
+    }
+
+    queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wakeCondition.notify_one();
+    }
+}
+
+FJob* JobSystem::FindJob(int32_t workerIndex) {
+    FJob* job = nullptr;
+
+    // 1. Deque propio (LIFO, caché caliente)
+    if (workerIndex >= 0 && workers[workerIndex]->deque.Pop(job)) {
+        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    // 2. Cola global (jobs de game/render thread)
+    {
+        std::lock_guard<std::mutex> lock(globalQueueMutex);
+        if (!globalQueue.empty()) {
+            job = globalQueue.front();
+            globalQueue.pop_front();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // 3. Robar a otros workers, empezando por el siguiente
+    const int32_t numWorkers = static_cast<int32_t>(workers.size());
+    for (int32_t offset = 1; offset <= numWorkers; offset++) {
+        int32_t victim = (workerIndex + offset + numWorkers) % numWorkers;
+        if (victim == workerIndex) {
+            continue;
+        }
+        if (workers[victim]->deque.Steal(job)) {
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void JobSystem::ExecuteJob(FJob* job) {
+    try {
+        job->task();
+    } catch (const std::exception& e) {
+        UE_LOG_ERROR(LogCategories::Core, "Exception in job: %s", e.what());
+    }
+
+    // Devolver el job al pool antes de completar el grupo: quien espera puede
+    // destruir lo que capturaba la tarea en cuanto el contador llega a 0
+    std::shared_ptr<FJobCounter> counter = std::move(job->counter);
+    ReleaseJob(job);
+    if (counter) {
+        counter->CompleteJob();
+    }
+}
+
+void JobSystem::WorkerMain(uint32_t workerIndex) {
+    GWorkerIndex = static_cast<int32_t>(workerIndex);
+
+    FThreadConfig config = workerConfig;
+    config.name = (config.name.empty() ? std::string("Worker") : config.name) + " " + std::to_string(workerIndex);
+    ThreadUtils::ApplyToCurrentThread(config, config.name);
+
+    FWorker& worker = *workers[workerIndex];
+    int spinCount = 0;
+    int jobsSinceCPUTimeSample = 0;
+    while (bRunning.load(std::memory_order_relaxed)) {
+        if (FJob* job = FindJob(GWorkerIndex)) {
+            ExecuteJob(job);
+            spinCount = 0;
+            if (++jobsSinceCPUTimeSample >= WORKER_CPU_TIME_SAMPLE_INTERVAL) {
+                worker.cpuTime.store(ThreadUtils::GetCurrentThreadCPUTime(), std::memory_order_relaxed);
+                jobsSinceCPUTimeSample = 0;
+            }
+            continue;
+        }
+
+        if (++spinCount < WORKER_SPIN_COUNT) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Sin trabajo: dormir hasta que alguien encole
+        worker.cpuTime.store(ThreadUtils::GetCurrentThreadCPUTime(), std::memory_order_relaxed);
+        jobsSinceCPUTimeSample = 0;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        wakeCondition.wait(lock, [this] {
+            return !bRunning.load(std::memory_order_relaxed) ||
+                   queuedJobs.load(std::memory_order_seq_cst) > 0;
+        });
+        sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+        spinCount = 0;
+    }
+
+    worker.cpuTime.store(ThreadUtils::GetCurrentThreadCPUTime(), std::memory_order_relaxed);
+    GWorkerIndex = -1;
+}
+
+void JobSystem::Wait(const FJobHandle& handle, bool bExecuteJobs) {
+    if (bExecuteJobs || IsInWorkerThread()) {
+        // Ayudar mientras esperamos (evita deadlock si un job espera a otros jobs)
+        while (!handle.IsComplete()) {
+            if (FJob* job = FindJob(GWorkerIndex)) {
+                ExecuteJob(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        return;
+    }
+
+    for (int i = 0; i < JOB_WAIT_SPIN_COUNT; i++) {
+        if (handle.IsComplete()) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    FJobCounter& counter = *handle.counter;
+    std::unique_lock<std::mutex> lock(counter.mutex);
+    counter.bHasWaiters.store(true, std::memory_order_seq_cst);
+    counter.condition.wait(lock, [&counter] {
+        return counter.pendingJobs.load(std::memory_order_seq_cst) == 0;
+    });
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    batchSize = std::max(1u, batchSize);
+
+    // Un solo lote o sin workers: ejecutar directamente
+    if (count <= batchSize || !bRunning) {
+        for (uint32_t i = 0; i < count; i++) {
+            body(i);
+        }
+        return;
+    }
+
+    FJobHandle handle = CreateHandle();
+    for (uint32_t begin = 0; begin < count; begin += batchSize) {
+        uint32_t end = std::min(count, begin + batchSize);
+        Submit([&body, begin, end]() {
+            for (uint32_t i = begin; i < end; i++) {
+                body(i);
+            }
+        }, handle);
+    }
+
+    Wait(handle, true);
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "WorkStealingDeque.h"
+#include "ThreadConfig.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// JobSystem - Sistema de jobs con work-stealing
+// Un worker por hardware thread, cada uno con su deque Chase-Lev. Los workers
+// sin trabajo roban a los demás. Similar a Unreal Engine's Task Graph.
+// ThreadManager lo inicia y lo detiene; game y render thread pueden repartir
+// trabajo con Submit/ParallelFor.
+// ============================================================================
+
+// Capacidad del deque de cada worker
+constexpr int64_t JOB_DEQUE_CAPACITY = 4096;
+
+// Jobs que reserva de una vez el pool de un thread cuando se le acaban los libres
+constexpr size_t JOB_POOL_BLOCK_SIZE = 256;
+
+// Iteraciones de spin de Wait antes de bloquear (threads que no ejecutan jobs)
+constexpr int JOB_WAIT_SPIN_COUNT = 256;
+
+// Contador de jobs pendientes de un grupo. Quien espera sin ejecutar jobs bloquea
+// en la condition variable; el último job del grupo solo la notifica si hay alguien.
+struct FJobCounter {
+    std::atomic<int32_t> pendingJobs{0};
+    std::atomic<bool> bHasWaiters{false};
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    // Marcar un job del grupo como terminado (thread que lo ejecutó)
+    void CompleteJob() {
+        if (pendingJobs.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+            bHasWaiters.load(std::memory_order_seq_cst)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+            condition.notify_all();
+        }
+    }
+};
+
+// Handle para esperar a un job (o grupo de jobs)
+class FJobHandle {
+public:
+    FJobHandle() = default;
+
+    bool IsValid() const { return counter != nullptr; }
+
+    // Lock-free: true cuando todos los jobs del grupo terminaron
+    bool IsComplete() const {
+        return !counter || counter->pendingJobs.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class JobSystem;
+    explicit FJobHandle(std::shared_ptr<FJobCounter> inCounter) : counter(std::move(inCounter)) {}
+
+    std::shared_ptr<FJobCounter> counter;
+};
+
+struct FJobPool;
+
+// Job: tarea + contador del grupo al que pertenece. Sale del pool del thread que
+// lo lanza y vuelve a él al terminar (ver FJobPool).
+struct FJob {
+    std::function<void()> task;
+    std::shared_ptr<FJobCounter> counter;
+    FJobPool* pool = nullptr;
+    FJob* nextFree = nullptr;
+};
+
+// Pool de jobs de un thread: Submit no reserva memoria salvo cuando el pool se queda
+// sin jobs libres (bloques de JOB_POOL_BLOCK_SIZE, que no se liberan hasta destruir el
+// JobSystem). Solo el dueño saca jobs; el thread que ejecuta un job lo devuelve con un
+// push lock-free a returnedJobs, y el dueño recoge la lista entera con un exchange
+// (sin ABA: nadie más saca de ella).
+struct FJobPool {
+    FJob* freeJobs = nullptr;                   // Solo el dueño
+    std::atomic<FJob*> returnedJobs{nullptr};   // Devueltos por otros threads
+    std::atomic<bool> bOwned{false};            // Algún thread vivo lo usa
+    std::vector<std::unique_ptr<FJob[]>> blocks;
+};
+
+class JobSystem {
+public:
+    static JobSystem& Get();
+
+    // Iniciar workers (0 = uno por hardware thread)
+    void Initialize(uint32_t numWorkers = 0);
+
+    // Nombre base, afinidad y prioridad de los workers. Antes de Initialize.
+    // Cada worker se llama "<name> <índice>" ("Worker <índice>" si name está vacío).
+    void SetWorkerThreadConfig(const FThreadConfig& config) { workerConfig = config; }
+
+    // Detener workers (los jobs pendientes se ejecutan antes de salir)
+    void Shutdown();
+
+    bool IsInitialized() const { return bInitialized; }
+    uint32_t GetNumWorkers() const { return static_cast<uint32_t>(workers.size()); }
+
+    // Tiempo de CPU consumido por un worker / por todos, en segundos
+    // (muestreado por cada worker cada WORKER_CPU_TIME_SAMPLE_INTERVAL jobs y antes de dormir)
+    double GetWorkerCPUTime(uint32_t workerIndex) const;
+    double GetTotalWorkerCPUTime() const;
+
+    // Verificar si el thread actual es un worker
+    bool IsInWorkerThread() const;
+
+    // Crear un handle vacío para agrupar varios jobs
+    FJobHandle CreateHandle();
+
+    // Lanzar un job (thread-safe). Sin workers, se ejecuta inmediatamente.
+    FJobHandle Submit(std::function<void()> task);
+
+    // Lanzar un job dentro de un grupo existente
+    void Submit(std::function<void()> task, FJobHandle& handle);
+
+    // Esperar a un handle. Un worker siempre ejecuta jobs mientras espera (así un job
+    // puede esperar a otros sin bloquear al worker). Otro thread (game, render) solo
+    // lo hace con bExecuteJobs; si no, hace un spin corto y bloquea hasta que el
+    // grupo termine, y los jobs se ejecutan en los workers.
+    void Wait(const FJobHandle& handle, bool bExecuteJobs = false);
+
+    // Ejecutar body(index) para index en [0, count) repartido en lotes de batchSize.
+    // Bloquea hasta terminar; el thread que llama también trabaja.
+    void ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t)>& body);
+
+private:
+    JobSystem() = default;
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    struct FWorker {
+        FWorker() : deque(JOB_DEQUE_CAPACITY) {}
+
+        TWorkStealingDeque<FJob*> deque;
+        std::thread thread;
+        std::atomic<double> cpuTime{0.0};
+    };
+
+    void WorkerMain(uint32_t workerIndex);
+
+    // Encolar en el deque del worker actual o en la cola global
+    void PushJob(FJob* job);
+
+    // Buscar trabajo: deque propio, cola global y robo a otros workers
+    FJob* FindJob(int32_t workerIndex);
+
+    void ExecuteJob(FJob* job);
+
+    // Pool del thread actual (se asigna en su primer Submit y se recicla cuando el thread termina)
+    FJobPool& GetThreadJobPool();
+
+    FJob* AllocateJob(std::function<void()>&& task, std::shared_ptr<FJobCounter> counter);
+    void ReleaseJob(FJob* job);
+
+    std::vector<std::unique_ptr<FWorker>> workers;
+    FThreadConfig workerConfig;
+
+    // Pools de jobs de todos los threads que lanzaron jobs
+    std::mutex jobPoolsMutex;
+    std::vector<std::unique_ptr<FJobPool>> jobPools;
+
+    // Cola global para jobs lanzados desde threads que no son workers
+    std::mutex globalQueueMutex;
+    std::deque<FJob*> globalQueue;
+
+    // Dormir/despertar workers sin trabajo
+    std::mutex sleepMutex;
+    std::condition_variable wakeCondition;
+    std::atomic<int32_t> queuedJobs{0};
+    std::atomic<int32_t> sleepingWorkers{0};
+
+    std::atomic<bool> bRunning{false};
+    std::atomic<bool> bInitialized{false};
+};
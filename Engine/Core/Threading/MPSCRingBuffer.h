@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// ============================================================================
+// TMPSCRingBuffer - Ring buffer acotado lock-free (multi-producer / single-consumer)
+// Basado en la cola acotada de Dmitry Vyukov: cada celda lleva un número de
+// secuencia que indica si está libre para el productor o lista para el consumidor.
+// ============================================================================
+
+// Tamaño de línea de caché usado para evitar false sharing
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+template<typename T>
+class TMPSCRingBuffer {
+public:
+    // La capacidad se redondea a la siguiente potencia de 2
+    explicit TMPSCRingBuffer(size_t requestedCapacity)
+        : capacity(RoundUpToPowerOfTwo(requestedCapacity))
+        , mask(capacity - 1)
+        , cells(new FCell[capacity])
+    {
+        for (size_t i = 0; i < capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    TMPSCRingBuffer(const TMPSCRingBuffer&) = delete;
+    TMPSCRingBuffer& operator=(const TMPSCRingBuffer&) = delete;
+
+    // Intentar encolar (cualquier thread). Devuelve false si el buffer está lleno,
+    // en cuyo caso 'item' no se modifica.
+    template<typename U>
+    bool TryPush(U&& item) {
+        static_assert(std::is_nothrow_assignable<T&, U&&>::value,
+                      "TryPush: assigning the item must not throw once the cell is claimed");
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            FCell& cell = cells[pos & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                // Celda libre: reclamarla
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = std::forward<U>(item);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // El consumidor aún no liberó esta celda: lleno
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Como TryPush, pero construye el elemento in-place: 'writer(T& slot)' solo se
+    // invoca si se reclamó una celda. El writer debe ser noexcept: una celda reclamada
+    // que nunca se publica bloquea al consumidor para siempre. Lo que pueda lanzar
+    // (copias, reservas) se hace antes de llamar a TryPushWith.
+    template<typename WriterType>
+    bool TryPushWith(WriterType&& writer) {
+        static_assert(noexcept(writer(std::declval<T&>())), "TryPushWith: the writer must be noexcept");
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            FCell& cell = cells[pos & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    writer(cell.data);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Reclamar 'count' celdas consecutivas con un único CAS y escribirlas con
+    // 'writer(size_t index, T& slot)', que debe ser noexcept (ver TryPushWith).
+    // Todo o nada: devuelve false si no caben.
+    template<typename WriterType>
+    bool TryPushRange(size_t count, WriterType&& writer) {
+        static_assert(noexcept(writer(size_t(0), std::declval<T&>())), "TryPushRange: the writer must be noexcept");
+        if (count == 0) {
+            return true;
+        }
+        if (count > capacity) {
+            return false;
+        }
+
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            // El consumidor libera en orden: si la última celda del rango está libre,
+            // las anteriores también
+            const size_t lastPos = pos + count - 1;
+            FCell& lastCell = cells[lastPos & mask];
+            size_t sequence = lastCell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(lastPos);
+
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                    // Publicar en orden: el consumidor avanza celda a celda
+                    for (size_t i = 0; i < count; i++) {
+                        FCell& cell = cells[(pos + i) & mask];
+                        writer(i, cell.data);
+                        cell.sequence.store(pos + i + 1, std::memory_order_release);
+                    }
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumir in-place (solo desde el thread consumidor): 'reader(T& slot)' debe
+    // dejar la celda lista para reutilizarse. Devuelve false si no hay elemento publicado.
+    template<typename ReaderType>
+    bool TryConsume(ReaderType&& reader) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        FCell& cell = cells[pos & mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+        if (sequence != pos + 1) {
+            return false;
+        }
+
+        reader(cell.data);
+        cell.sequence.store(pos + capacity, std::memory_order_release);
+        dequeuePos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Intentar desencolar (solo desde el thread consumidor).
+    // Devuelve false si la siguiente celda aún no fue publicada.
+    bool TryPop(T& out) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        FCell& cell = cells[pos & mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+        if (sequence != pos + 1) {
+            return false;
+        }
+
+        out = std::move(cell.data);
+        cell.data = T();
+        cell.sequence.store(pos + capacity, std::memory_order_release);
+        dequeuePos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Número de slots reclamados por productores (incluye los que aún se están escribiendo)
+    size_t GetClaimedCount() const { return enqueuePos.load(std::memory_order_acquire); }
+
+    // Número de elementos consumidos
+    size_t GetConsumedCount() const { return dequeuePos.load(std::memory_order_acquire); }
+
+    // Tamaño aproximado (exacto solo si no hay productores activos)
+    size_t SizeApprox() const {
+        size_t consumed = GetConsumedCount();
+        size_t claimed = GetClaimedCount();
+        return claimed > consumed ? claimed - consumed : 0;
+    }
+
+    bool IsEmptyApprox() const { return SizeApprox() == 0; }
+
+    size_t Capacity() const { return capacity; }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) FCell {
+        std::atomic<size_t> sequence{0};
+        T data;
+    };
+
+    static size_t RoundUpToPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<FCell[]> cells;
+
+    // Productores y consumidor escriben en líneas de caché distintas
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos{0};
+};
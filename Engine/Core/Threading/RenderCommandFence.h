@@ -0,0 +1,51 @@
+#pragma once
+
+#include "RenderCommandQueue.h"
+#include "ThreadManager.h"
+#include <cstdint>
+
+// ============================================================================
+// FRenderCommandFence - Saber cuándo el render thread ejecutó los comandos
+// encolados hasta un punto. Similar a Unreal Engine's FRenderCommandFence.
+//
+// BeginFence() encola un marcador con un número de secuencia creciente; el
+// render thread publica el último número completado al final de cada pasada.
+// IsFenceComplete() es lock-free; Wait() hace un spin corto y luego bloquea.
+//
+// Uso típico: retirar recursos compartidos con la GPU sin vaciar toda la cola.
+//   fence.BeginFence();
+//   ... más tarde ...
+//   if (fence.IsFenceComplete()) { DestroyResource(); }
+// ============================================================================
+
+class FRenderCommandFence {
+public:
+    FRenderCommandFence() = default;
+
+    // Encolar el fence detrás de todos los comandos encolados hasta ahora por este thread
+    void BeginFence() {
+        fenceSequence = RenderCommandQueue::Get().EnqueueFence();
+    }
+
+    // Lock-free. Un fence que nunca se inició está completo.
+    bool IsFenceComplete() const {
+        return fenceSequence == 0 || RenderCommandQueue::Get().IsFenceComplete(fenceSequence);
+    }
+
+    // Bloquear hasta que el render thread ejecute el fence. Desde el render thread,
+    // o sin ThreadManager en marcha, ejecuta los comandos en el thread que espera.
+    void Wait() const {
+        if (IsFenceComplete()) {
+            return;
+        }
+
+        ThreadManager& threadManager = ThreadManager::Get();
+        bool bExecuteCommands = threadManager.IsInRenderThread() || !threadManager.IsInitialized();
+        RenderCommandQueue::Get().WaitForFence(fenceSequence, bExecuteCommands);
+    }
+
+    uint64_t GetSequence() const { return fenceSequence; }
+
+private:
+    uint64_t fenceSequence = 0;
+};
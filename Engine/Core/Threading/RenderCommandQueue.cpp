@@ -1,5 +1,8 @@
 #include "RenderCommandQueue.h"
+#include "TaskHandle.h"
 #include "../Log.h"
+#include "../Stats.h"
+#include <algorithm>
 #include <thread>
 
 RenderCommandQueue& RenderCommandQueue::Get() {
@@ -7,103 +10,168 @@ RenderCommandQueue& RenderCommandQueue::Get() {
     return instance;
 }
 
-void RenderCommandQueue::Enqueue(ERenderCommandType type, std::function<void()> command) {
-    if (bShutdown) {
-        UE_LOG_WARNING(LogCategories::Core, "Attempting to enqueue render command after shutdown");
+RenderCommandQueue::RenderCommandQueue()
+    : commandQueue(RENDER_COMMAND_RING_CAPACITY)
+{
+}
+
+void RenderCommandQueue::WarnEnqueueAfterShutdown() {
+    UE_LOG_WARNING(LogCategories::Core, "Attempting to enqueue render command after shutdown");
+}
+
+void RenderCommandQueue::EnqueueBatch(std::vector<FRenderCommand>&& commands) {
+    if (commandQueue.IsShutdown()) {
         return;
     }
-    
-    {
-        std::lock_guard<std::mutex> lock(queueMutex);
-        commandQueue.push(std::make_unique<FRenderCommand>(type, command));
+
+    // Con buffer activo, respetar el orden respecto a lo ya acumulado
+    if (std::vector<FRenderCommand>* buffer = threadCommandBuffer) {
+        for (auto& cmd : commands) {
+            buffer->push_back(std::move(cmd));
+        }
+        commands.clear();
+        if (buffer->size() >= RENDER_COMMAND_BUFFER_FLUSH_THRESHOLD) {
+            FlushThreadCommands();
+        }
+        return;
     }
-    
-    conditionVariable.notify_one();
+
+    commandQueue.EnqueueCommands(commands.data(), commands.size());
+    commands.clear();
 }
 
-void RenderCommandQueue::EnqueueBatch(const std::vector<FRenderCommand>& commands) {
-    if (bShutdown) {
+void RenderCommandQueue::FlushThreadCommands() {
+    std::vector<FRenderCommand>* buffer = threadCommandBuffer;
+    if (buffer == nullptr || buffer->empty()) {
         return;
     }
-    
-    {
-        std::lock_guard<std::mutex> lock(queueMutex);
-        for (const auto& cmd : commands) {
-            commandQueue.push(std::make_unique<FRenderCommand>(cmd.type, cmd.executeFunction));
-        }
-    }
-    
-    conditionVariable.notify_one();
+
+    // Tras el Shutdown se descartan, igual que en EnqueueBatch
+    commandQueue.EnqueueCommands(buffer->data(), buffer->size());
+    buffer->clear();
 }
 
+DECLARE_CYCLE_STAT("RenderCommands", STAT_RenderCommands, Render);
+DECLARE_DWORD_COUNTER_STAT("Render commands executed", STAT_RenderCommandsExecuted, Render);
+
 void RenderCommandQueue::ExecuteAll() {
-    std::queue<std::unique_ptr<FRenderCommand>> commandsToExecute;
-    
-    // Mover comandos a una cola local (minimizar tiempo con mutex)
-    {
-        std::lock_guard<std::mutex> lock(queueMutex);
-        while (!commandQueue.empty()) {
-            commandsToExecute.push(std::move(commandQueue.front()));
-            commandQueue.pop();
-        }
-    }
-    
-    // Ejecutar comandos sin mutex
-    size_t commandCount = 0;
-    while (!commandsToExecute.empty()) {
-        auto& command = commandsToExecute.front();
-        if (command && command->executeFunction) {
-            try {
-                command->executeFunction();
-            } catch (const std::exception& e) {
-                UE_LOG_ERROR(LogCategories::Core, "Exception in render command: %s", e.what());
-            }
-        }
-        commandsToExecute.pop();
-        commandCount++;
-    }
-    
+    SCOPE_CYCLE_COUNTER(STAT_RenderCommands);
+    size_t commandCount = commandQueue.ExecuteAll([this](size_t) {
+        PublishCompletedFence();
+    });
+    INC_DWORD_STAT_BY(STAT_RenderCommandsExecuted, commandCount);
     if (commandCount > 0) {
         UE_LOG_VERBOSE(LogCategories::Core, "Executed %zu render commands", commandCount);
     }
 }
 
 void RenderCommandQueue::ExecuteUntilEmpty() {
-    while (!IsEmpty()) {
-        ExecuteAll();
-    }
+    commandQueue.ExecuteUntilEmpty();
 }
 
 void RenderCommandQueue::Clear() {
-    std::lock_guard<std::mutex> lock(queueMutex);
-    std::queue<std::unique_ptr<FRenderCommand>> empty;
-    commandQueue.swap(empty);
+    commandQueue.Clear();
+    
+    // Los fences descartados no se ejecutarán nunca: darlos por completados
+    uint64_t fence = issuedFence.load(std::memory_order_acquire);
+    clearedFence.store(fence, std::memory_order_release);
+    AdvanceCompletedFence(fence);
 }
 
-size_t RenderCommandQueue::Size() const {
-    std::lock_guard<std::mutex> lock(queueMutex);
-    return commandQueue.size();
+void RenderCommandQueue::Shutdown() {
+    commandQueue.Shutdown();
+    
+    // IsFenceComplete es true tras el shutdown: despertar a quien espera
+    AdvanceCompletedFence(issuedFence.load(std::memory_order_acquire));
 }
 
-bool RenderCommandQueue::IsEmpty() const {
-    std::lock_guard<std::mutex> lock(queueMutex);
-    return commandQueue.empty();
+uint64_t RenderCommandQueue::EnqueueFence() {
+    uint64_t fence = issuedFence.fetch_add(1, std::memory_order_acq_rel) + 1;
+    Enqueue(ERenderCommandType::Fence, [this, fence]() {
+        RetireFence(fence);
+    });
+    
+    // Quien espere el fence necesita que los comandos anteriores lleguen a la cola
+    FlushThreadCommands();
+    return fence;
 }
 
-void RenderCommandQueue::WaitForCommands() {
-    std::unique_lock<std::mutex> lock(queueMutex);
-    conditionVariable.wait(lock, [this] {
-        return !commandQueue.empty() || bShutdown;
-    });
+void RenderCommandQueue::RetireFence(uint64_t fence) {
+    // Dos productores pueden obtener números consecutivos y encolarlos en orden
+    // inverso: el fence N solo se publica cuando todos los anteriores se ejecutaron
+    if (fence == retiredFence + 1) {
+        retiredFence = fence;
+    } else if (fence > retiredFence) {
+        outOfOrderFences.push_back(fence);
+    }
 }
 
-void RenderCommandQueue::NotifyCommandsAvailable() {
-    conditionVariable.notify_one();
+void RenderCommandQueue::PublishCompletedFence() {
+    // Los descartados por Clear() cuentan como ejecutados
+    retiredFence = std::max(retiredFence, clearedFence.load(std::memory_order_acquire));
+    
+    if (!outOfOrderFences.empty()) {
+        std::sort(outOfOrderFences.begin(), outOfOrderFences.end());
+        size_t consumed = 0;
+        for (uint64_t fence : outOfOrderFences) {
+            if (fence <= retiredFence) {
+                consumed++;
+            } else if (fence == retiredFence + 1) {
+                retiredFence = fence;
+                consumed++;
+            } else {
+                break;
+            }
+        }
+        outOfOrderFences.erase(outOfOrderFences.begin(), outOfOrderFences.begin() + consumed);
+    }
+    
+    AdvanceCompletedFence(retiredFence);
 }
 
-void RenderCommandQueue::Shutdown() {
-    bShutdown = true;
-    conditionVariable.notify_all();
-    Clear();
+void RenderCommandQueue::AdvanceCompletedFence(uint64_t fence) {
+    uint64_t current = completedFence.load(std::memory_order_relaxed);
+    while (fence > current &&
+           !completedFence.compare_exchange_weak(current, fence, std::memory_order_seq_cst)) {
+    }
+    
+    // Solo tomar el mutex si alguien llegó a bloquear
+    if (fenceWaiters.load(std::memory_order_seq_cst) > 0) {
+        {
+            std::lock_guard<std::mutex> lock(fenceMutex);
+        }
+        fenceCondition.notify_all();
+    }
 }
 
+void RenderCommandQueue::WaitForFence(uint64_t fence, bool bExecuteCommands) {
+    if (bExecuteCommands) {
+        // Somos el consumidor: ejecutar hasta llegar al fence
+        while (!IsFenceComplete(fence)) {
+            ExecuteAll();
+            if (!IsFenceComplete(fence)) {
+                std::this_thread::yield();
+            }
+        }
+        return;
+    }
+    
+    for (int i = 0; i < TASK_WAIT_SPIN_COUNT; i++) {
+        if (IsFenceComplete(fence)) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+    
+    fenceWaiters.fetch_add(1, std::memory_order_seq_cst);
+    if (fenceWaitHandler) {
+        fenceWaitHandler();
+    }
+    {
+        std::unique_lock<std::mutex> lock(fenceMutex);
+        fenceCondition.wait(lock, [this, fence] {
+            return fence <= completedFence.load(std::memory_order_seq_cst) || commandQueue.IsShutdown();
+        });
+    }
+    fenceWaiters.fetch_sub(1, std::memory_order_seq_cst);
+}
@@ -1,18 +1,37 @@
 #pragma once
 
+#include "CommandQueue.h"
+#include "InlineCommand.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
-#include <queue>
 #include <mutex>
-#include <condition_variable>
-#include <atomic>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <memory>
 
 // ============================================================================
 // RenderCommandQueue - Cola thread-safe para comandos de renderizado
 // Similar a Unreal Engine's Render Command Queue
+//
+// Backend: TCommandQueue (ring buffer lock-free MPSC con overflow), compartido
+// con la cola de tareas del game thread. Los comandos guardan su lambda inline
+// y ExecuteAll los ejecuta y destruye in-place recorriendo el ring.
+// Enqueue no despierta al render thread: los productores llaman
+// NotifyCommandsAvailable() una vez por frame.
+// Con FScopedRenderCommandBuffer, Enqueue añade a un buffer del propio thread sin
+// sincronización y el buffer se vuelca a la cola en un solo bloque (una vez por
+// frame o al llegar a RENDER_COMMAND_BUFFER_FLUSH_THRESHOLD).
+// Los fences (FRenderCommandFence) permiten saber cuándo se ejecutó un comando.
 // ============================================================================
 
+// Capacidad del ring buffer de comandos (potencia de 2)
+constexpr size_t RENDER_COMMAND_RING_CAPACITY = 4096;
+
+// Comandos acumulados en el buffer de un thread antes de volcarlo a la cola
+constexpr size_t RENDER_COMMAND_BUFFER_FLUSH_THRESHOLD = 256;
+
 // Tipos de comandos de renderizado
 enum class ERenderCommandType {
     Draw,
@@ -21,62 +40,210 @@ enum class ERenderCommandType {
     UpdateCamera,
     CreateResource,
     DestroyResource,
+    Fence,
     Custom
 };
 
-// Estructura base para comandos de renderizado
+// Comando de renderizado: tipo + lambda con almacenamiento inline (FInlineCommand).
+// El lambda se construye in-place dentro del comando, que a su vez vive en la celda
+// del ring buffer: encolar y ejecutar no reserva memoria.
 struct FRenderCommand {
-    ERenderCommandType type;
-    std::function<void()> executeFunction;
+    ERenderCommandType type = ERenderCommandType::Custom;
+    FInlineCommand command;
+    
+    FRenderCommand() = default;
+    
+    template<typename LambdaType,
+             typename = std::enable_if_t<!std::is_same<std::decay_t<LambdaType>, FRenderCommand>::value>>
+    FRenderCommand(ERenderCommandType cmdType, LambdaType&& lambda) {
+        Emplace(cmdType, std::forward<LambdaType>(lambda));
+    }
+    
+    FRenderCommand(FRenderCommand&&) noexcept = default;
+    FRenderCommand& operator=(FRenderCommand&&) noexcept = default;
+    
+    // Construir el lambda dentro del comando (destruye el anterior si había uno)
+    template<typename LambdaType>
+    void Emplace(ERenderCommandType cmdType, LambdaType&& lambda)
+        noexcept(FInlineCommand::IsNothrowEmplaceable<LambdaType>()) {
+        type = cmdType;
+        command.Emplace(std::forward<LambdaType>(lambda));
+    }
     
-    FRenderCommand(ERenderCommandType cmdType, std::function<void()> func)
-        : type(cmdType), executeFunction(func) {}
+    bool IsBound() const { return command.IsBound(); }
+    
+    void Execute() { command.Execute(); }
+    
+    // Destruir el lambda y dejar el comando vacío
+    void Reset() { command.Reset(); }
 };
 
+// Celda del ring = número de secuencia (con padding hasta la alineación del comando)
+// + FRenderCommand (ver FInlineCommand::INLINE_SIZE)
+static_assert(alignof(FRenderCommand) + sizeof(FRenderCommand) <= 2 * CACHE_LINE_SIZE,
+              "FRenderCommand ring cells should fit in two cache lines");
+
 class RenderCommandQueue {
 public:
     static RenderCommandQueue& Get();
     
-    // Agregar comando a la cola (thread-safe, puede ser llamado desde cualquier thread)
-    void Enqueue(ERenderCommandType type, std::function<void()> command);
+    // Agregar comando a la cola (thread-safe, puede ser llamado desde cualquier thread).
+    // El lambda se construye directamente en la celda del ring, sin reservar memoria
+    // (si copiarlo puede lanzar, se construye antes de reclamar la celda).
+    // Si el thread tiene un buffer activo (FScopedRenderCommandBuffer), el comando se
+    // añade al buffer y llega a la cola al volcarlo.
+    template<typename LambdaType>
+    void Enqueue(ERenderCommandType type, LambdaType&& command) {
+        if (std::vector<FRenderCommand>* buffer = threadCommandBuffer) {
+            buffer->emplace_back(type, std::forward<LambdaType>(command));
+            if (buffer->size() >= RENDER_COMMAND_BUFFER_FLUSH_THRESHOLD) {
+                FlushThreadCommands();
+            }
+            return;
+        }
+        
+        if (!commandQueue.Enqueue(type, std::forward<LambdaType>(command))) {
+            WarnEnqueueAfterShutdown();
+        }
+    }
+    
+    // Encolar múltiples comandos (se mueven, no se copian) con una sola operación
+    // atómica sobre el ring
+    void EnqueueBatch(std::vector<FRenderCommand>&& commands);
+    
+    // Volcar a la cola el buffer del thread actual, en orden (no hace nada sin buffer).
+    // Tras el Shutdown los comandos se descartan.
+    void FlushThreadCommands();
     
-    // Encolar múltiples comandos
-    void EnqueueBatch(const std::vector<FRenderCommand>& commands);
+    // El thread actual acumula sus comandos en un buffer propio
+    bool HasThreadCommandBuffer() const { return threadCommandBuffer != nullptr; }
     
-    // Ejecutar todos los comandos en la cola (debe ser llamado desde render thread)
+    // Ejecutar todos los comandos en la cola (debe ser llamado desde render thread).
+    // Si otro thread ya está consumiendo, retorna sin hacer nada (el ring es single-consumer).
     void ExecuteAll();
     
     // Ejecutar comandos hasta que la cola esté vacía
     void ExecuteUntilEmpty();
     
-    // Limpiar cola (thread-safe)
+    // Limpiar cola (thread-safe). Los fences descartados cuentan como completados.
     void Clear();
     
-    // Obtener tamaño de la cola
-    size_t Size() const;
+    // Obtener tamaño de la cola (aproximado mientras haya productores activos)
+    size_t Size() const { return commandQueue.Size(); }
     
-    // Verificar si la cola está vacía
-    bool IsEmpty() const;
+    // Verificar si la cola está vacía (lock-free)
+    bool IsEmpty() const { return commandQueue.IsEmpty(); }
     
     // Esperar hasta que haya comandos (para render thread)
-    void WaitForCommands();
+    void WaitForCommands() { commandQueue.WaitForCommands(); }
     
-    // Notificar que hay comandos (para despertar render thread)
-    void NotifyCommandsAvailable();
+    // Notificar que hay comandos (para despertar render thread).
+    // Llamar una vez por frame desde el productor; no hace nada si no se encoló nada.
+    void NotifyCommandsAvailable() { commandQueue.NotifyCommandsAvailable(); }
     
     // Shutdown (limpiar y detener notificaciones)
     void Shutdown();
+    
+    // --- Fences (ver RenderCommandFence.h) ---
+    // Cada fence tiene un número de secuencia creciente. El render thread publica,
+    // al final de cada pasada de ExecuteAll, el mayor número N tal que todos los
+    // fences <= N ya se ejecutaron.
+    
+    // Encolar un fence y devolver su número de secuencia. Vuelca el buffer del thread
+    // para que el fence sea visible para el render thread.
+    uint64_t EnqueueFence();
+    
+    // Lock-free
+    uint64_t GetCompletedFence() const { return completedFence.load(std::memory_order_acquire); }
+    bool IsFenceComplete(uint64_t fence) const {
+        return fence <= GetCompletedFence() || commandQueue.IsShutdown();
+    }
+    
+    // Bloquear hasta que el fence se complete. Con bExecuteCommands el thread que espera
+    // ejecuta él mismo los comandos (render thread, o sin render thread en marcha).
+    void WaitForFence(uint64_t fence, bool bExecuteCommands);
+    
+    // Hay threads bloqueados en WaitForFence (el render thread debe vaciar la cola aunque
+    // no haya frame nuevo)
+    bool HasFenceWaiters() const { return fenceWaiters.load(std::memory_order_seq_cst) > 0; }
+    
+    // Llamado cuando un thread va a bloquear en WaitForFence (ThreadManager lo usa para
+    // despertar al render thread). Configurar sin threads esperando.
+    void SetFenceWaitHandler(std::function<void()> handler) { fenceWaitHandler = std::move(handler); }
 
 private:
-    RenderCommandQueue() = default;
+    friend class FScopedRenderCommandBuffer;
+    
+    RenderCommandQueue();
     ~RenderCommandQueue() = default;
     RenderCommandQueue(const RenderCommandQueue&) = delete;
     RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
     
-    mutable std::mutex queueMutex;
-    std::queue<std::unique_ptr<FRenderCommand>> commandQueue;
-    std::condition_variable conditionVariable;
-    std::atomic<bool> bShutdown{false};
+    void WarnEnqueueAfterShutdown();
+    
+    // Render thread, dentro de la pasada: marcar un fence como ejecutado
+    void RetireFence(uint64_t fence);
+    
+    // Render thread, al final de la pasada: publicar el fence completado
+    void PublishCompletedFence();
+    
+    // Avanzar completedFence (nunca retrocede) y despertar a quien espera
+    void AdvanceCompletedFence(uint64_t fence);
+    
+    // Ring lock-free + overflow (ver CommandQueue.h)
+    TCommandQueue<FRenderCommand> commandQueue;
+    
+    // Fences
+    std::atomic<uint64_t> issuedFence{0};
+    std::atomic<uint64_t> completedFence{0};
+    std::atomic<uint64_t> clearedFence{0};      // Fences <= este se descartaron con Clear()
+    uint64_t retiredFence = 0;                  // Solo consumidor: fences contiguos ejecutados
+    std::vector<uint64_t> outOfOrderFences;     // Solo consumidor: ejecutados antes que uno anterior
+    std::mutex fenceMutex;
+    std::condition_variable fenceCondition;
+    std::atomic<int32_t> fenceWaiters{0};
+    std::function<void()> fenceWaitHandler;
+    
+    // Buffer activo del thread actual (lo instala FScopedRenderCommandBuffer)
+    static inline thread_local std::vector<FRenderCommand>* threadCommandBuffer = nullptr;
+};
+
+// ============================================================================
+// FScopedRenderCommandBuffer - Buffer de comandos por thread
+// Mientras vive, los Enqueue del thread se acumulan en un vector local sin
+// atómicos ni locks; el buffer se vuelca a la cola con FlushThreadCommands(), al
+// llegar a RENDER_COMMAND_BUFFER_FLUSH_THRESHOLD y al destruirse. Cada volcado es
+// una única reserva de celdas en el ring, así que la sincronización entre threads
+// pasa a ser por volcado y no por comando. Los comandos de un mismo thread se
+// ejecutan en el orden en que se encolaron.
+//
+// El game thread tiene uno durante toda su vida y lo vuelca al final de cada tick.
+// Un scope anidado reutiliza el buffer ya activo.
+// ============================================================================
+
+class FScopedRenderCommandBuffer {
+public:
+    FScopedRenderCommandBuffer() {
+        if (RenderCommandQueue::threadCommandBuffer == nullptr) {
+            commands.reserve(RENDER_COMMAND_BUFFER_FLUSH_THRESHOLD);
+            RenderCommandQueue::threadCommandBuffer = &commands;
+            bOwnsBuffer = true;
+        }
+    }
+    
+    ~FScopedRenderCommandBuffer() {
+        if (bOwnsBuffer) {
+            RenderCommandQueue::Get().FlushThreadCommands();
+            RenderCommandQueue::threadCommandBuffer = nullptr;
+        }
+    }
+    
+    FScopedRenderCommandBuffer(const FScopedRenderCommandBuffer&) = delete;
+    FScopedRenderCommandBuffer& operator=(const FScopedRenderCommandBuffer&) = delete;
+
+private:
+    std::vector<FRenderCommand> commands;
+    bool bOwnsBuffer = false;
 };
 
 // Macros útiles para encolar comandos
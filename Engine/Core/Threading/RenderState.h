@@ -0,0 +1,95 @@
+#pragma once
+
+#include "MPSCRingBuffer.h"
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+// ============================================================================
+// TRenderState - Snapshot de estado game -> render con triple buffer lock-free
+//
+// El game thread escribe en su slot (GetWriteState) y lo publica con Publish(),
+// que es un único exchange atómico. El render thread llama GetReadState() y
+// obtiene el último snapshot completo publicado, también con un exchange; si no
+// hay uno nuevo sigue leyendo el anterior. Ninguno de los dos bloquea.
+//
+// Tres slots: uno del escritor, uno del lector y uno "en tránsito" que se
+// intercambia. Con solo dos, el escritor tendría que esperar a que el lector
+// suelte el suyo.
+//
+// Un solo escritor y un solo lector. Tras Publish() el slot de escritura
+// contiene un snapshot antiguo: reescribir el estado completo cada frame (o
+// copiar desde el propio estado del game thread).
+// ============================================================================
+
+template<typename T>
+class TRenderState {
+public:
+    TRenderState() = default;
+
+    explicit TRenderState(const T& initialState) {
+        for (FSlot& slot : slots) {
+            slot.state = initialState;
+        }
+    }
+
+    TRenderState(const TRenderState&) = delete;
+    TRenderState& operator=(const TRenderState&) = delete;
+
+    // --- Game thread ---
+
+    // Slot privado del escritor
+    T& GetWriteState() { return slots[writeIndex].state; }
+
+    // Publicar el slot de escritura como último snapshot
+    void Publish() {
+        uint32_t previous = middle.exchange(writeIndex | NEW_STATE_BIT, std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+        publishCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Copiar y publicar en un paso
+    void Publish(const T& state) {
+        GetWriteState() = state;
+        Publish();
+    }
+
+    // --- Render thread ---
+
+    // Último snapshot publicado (el mismo que la llamada anterior si no hay uno nuevo).
+    // La referencia es válida hasta la siguiente llamada a GetReadState.
+    const T& GetReadState() {
+        if (middle.load(std::memory_order_relaxed) & NEW_STATE_BIT) {
+            uint32_t previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+            readIndex = previous & INDEX_MASK;
+        }
+        return slots[readIndex].state;
+    }
+
+    // Lock-free: true si hay un snapshot que el lector aún no ha tomado
+    bool HasNewState() const {
+        return (middle.load(std::memory_order_acquire) & NEW_STATE_BIT) != 0;
+    }
+
+    // Snapshots publicados desde la creación
+    uint64_t GetPublishCount() const { return publishCount.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr uint32_t NEW_STATE_BIT = 0x4;
+    static constexpr uint32_t INDEX_MASK = 0x3;
+
+    // Cada slot en su propia línea de caché (escritor y lector no comparten líneas)
+    struct alignas(CACHE_LINE_SIZE) FSlot {
+        T state{};
+    };
+
+    FSlot slots[3];
+
+    // Índice del slot en tránsito + bit de "snapshot nuevo sin leer"
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> middle{1};
+    std::atomic<uint64_t> publishCount{0};
+
+    // Propiedad exclusiva de cada thread
+    alignas(CACHE_LINE_SIZE) uint32_t writeIndex = 0;
+    alignas(CACHE_LINE_SIZE) uint32_t readIndex = 2;
+};
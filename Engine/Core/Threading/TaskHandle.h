@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// ============================================================================
+// FTaskHandle - Handle de finalización de una tarea encolada en otro thread
+// (ThreadManager::ExecuteInGameThread). IsComplete es lock-free; Wait hace un
+// spin corto y después bloquea en una condition variable, así que esperar
+// tareas cortas no paga un cambio de contexto.
+// ============================================================================
+
+// Iteraciones de spin antes de bloquear en Wait
+constexpr int TASK_WAIT_SPIN_COUNT = 256;
+
+// Estado compartido entre la tarea y sus handles
+struct FTaskCompletion {
+    std::atomic<bool> bComplete{false};
+    std::atomic<bool> bHasWaiters{false};
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    // Marcar como completada (thread que ejecuta la tarea)
+    void Complete() {
+        bComplete.store(true, std::memory_order_seq_cst);
+
+        // Solo tomar el mutex si alguien llegó a bloquear
+        if (bHasWaiters.load(std::memory_order_seq_cst)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+            condition.notify_all();
+        }
+    }
+
+    void Wait() {
+        for (int i = 0; i < TASK_WAIT_SPIN_COUNT; i++) {
+            if (bComplete.load(std::memory_order_acquire)) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        bHasWaiters.store(true, std::memory_order_seq_cst);
+        condition.wait(lock, [this] { return bComplete.load(std::memory_order_seq_cst); });
+    }
+};
+
+class FTaskHandle {
+public:
+    FTaskHandle() = default;
+
+    // Handle de una tarea que ya se ejecutó (ejecución inline)
+    static FTaskHandle MakeCompleted() {
+        FTaskHandle handle = Make();
+        handle.completion->bComplete = true;
+        return handle;
+    }
+
+    static FTaskHandle Make() {
+        FTaskHandle handle;
+        handle.completion = std::make_shared<FTaskCompletion>();
+        return handle;
+    }
+
+    bool IsValid() const { return completion != nullptr; }
+
+    // Lock-free: true cuando la tarea terminó (o si el handle no es válido)
+    bool IsComplete() const {
+        return !completion || completion->bComplete.load(std::memory_order_acquire);
+    }
+
+    // Bloquear hasta que la tarea termine. No llamar desde el thread que debe ejecutarla.
+    void Wait() const {
+        if (completion) {
+            completion->Wait();
+        }
+    }
+
+    // Marcar como completada (lo llama quien ejecuta la tarea)
+    void Complete() const {
+        if (completion) {
+            completion->Complete();
+        }
+    }
+
+private:
+    std::shared_ptr<FTaskCompletion> completion;
+};
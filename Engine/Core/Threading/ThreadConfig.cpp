@@ -0,0 +1,135 @@
+#include "ThreadConfig.h"
+#include "../Log.h"
+#include "../Profiler.h"
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace ThreadUtils {
+
+namespace {
+
+// Límite de pthread_setname_np en Linux (16 bytes incluyendo el terminador)
+constexpr size_t MAX_THREAD_NAME_LENGTH = 15;
+
+bool SetCurrentThreadName(const std::string& name) {
+    std::string truncatedName = name.substr(0, MAX_THREAD_NAME_LENGTH);
+#if defined(__linux__)
+    int result = pthread_setname_np(pthread_self(), truncatedName.c_str());
+    if (result != 0) {
+        UE_LOG_WARNING(LogCategories::Core, "Failed to set thread name '%s': %s",
+                       truncatedName.c_str(), strerror(result));
+        return false;
+    }
+    return true;
+#elif defined(__APPLE__)
+    return pthread_setname_np(truncatedName.c_str()) == 0;
+#else
+    (void)truncatedName;
+    return false;
+#endif
+}
+
+bool SetCurrentThreadAffinity(const std::vector<uint32_t>& cores, const std::string& name) {
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint32_t core : cores) {
+        if (core >= CPU_SETSIZE) {
+            UE_LOG_WARNING(LogCategories::Core, "Ignoring invalid CPU %u in affinity of %s", core, name.c_str());
+            continue;
+        }
+        CPU_SET(core, &cpuSet);
+    }
+
+    int result = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    if (result != 0) {
+        UE_LOG_WARNING(LogCategories::Core, "Failed to set CPU affinity of %s: %s", name.c_str(), strerror(result));
+        return false;
+    }
+    return true;
+#else
+    UE_LOG_WARNING(LogCategories::Core, "CPU affinity not supported on this platform (%s)", name.c_str());
+    return false;
+#endif
+}
+
+bool SetCurrentThreadPriority(EThreadPriorityPolicy policy, int32_t priority, const std::string& name) {
+#if defined(__linux__)
+    if (policy == EThreadPriorityPolicy::RealtimeFIFO) {
+        sched_param param{};
+        param.sched_priority = priority;
+        int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (result != 0) {
+            UE_LOG_WARNING(LogCategories::Core, "Failed to set SCHED_FIFO priority %d on %s: %s",
+                           priority, name.c_str(), strerror(result));
+            return false;
+        }
+        return true;
+    }
+
+    // En Linux el valor nice es por thread (tid), no por proceso
+    pid_t threadId = static_cast<pid_t>(syscall(SYS_gettid));
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(threadId), priority) != 0) {
+        UE_LOG_WARNING(LogCategories::Core, "Failed to set nice %d on %s: %s",
+                       priority, name.c_str(), strerror(errno));
+        return false;
+    }
+    return true;
+#else
+    (void)priority;
+    UE_LOG_WARNING(LogCategories::Core, "Thread priority policy %d not supported on this platform (%s)",
+                   static_cast<int>(policy), name.c_str());
+    return false;
+#endif
+}
+
+} // namespace
+
+bool ApplyToCurrentThread(const FThreadConfig& config, const std::string& defaultName) {
+    const std::string& name = config.name.empty() ? defaultName : config.name;
+    bool bSuccess = true;
+
+    if (!name.empty()) {
+        bSuccess &= SetCurrentThreadName(name);
+        FProfiler::SetCurrentThreadName(name);
+    }
+
+    if (!config.affinityCores.empty()) {
+        bSuccess &= SetCurrentThreadAffinity(config.affinityCores, name);
+    }
+
+    if (config.priorityPolicy != EThreadPriorityPolicy::Default) {
+        bSuccess &= SetCurrentThreadPriority(config.priorityPolicy, config.priority, name);
+    }
+
+    return bSuccess;
+}
+
+double GetCurrentThreadCPUTime() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec time{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0) {
+        return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+    }
+#endif
+    return 0.0;
+}
+
+uint32_t GetNumLogicalCores() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 0 ? cores : 1;
+}
+
+} // namespace ThreadUtils
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// FThreadConfig - Nombre, afinidad y prioridad de un thread del motor
+// ThreadManager aplica una configuración al game thread, al render thread y a
+// los workers del JobSystem al arrancarlos. Implementado con pthreads en Linux;
+// en otras plataformas solo se aplica lo que esté soportado.
+// ============================================================================
+
+enum class EThreadPriorityPolicy {
+    Default,        // No tocar la política del sistema
+    Nice,           // SCHED_OTHER con valor nice = priority (-20..19, negativo requiere permisos)
+    RealtimeFIFO    // SCHED_FIFO con prioridad = priority (1..99, requiere CAP_SYS_NICE)
+};
+
+struct FThreadConfig {
+    // Nombre visible en top/htop/gdb/perf (máximo 15 caracteres en Linux; se trunca).
+    // Vacío = nombre por defecto del thread.
+    std::string name;
+
+    // CPUs lógicas en las que puede correr el thread. Vacío = sin restricción.
+    std::vector<uint32_t> affinityCores;
+
+    EThreadPriorityPolicy priorityPolicy = EThreadPriorityPolicy::Default;
+    int32_t priority = 0;
+};
+
+namespace ThreadUtils {
+    // Aplicar la configuración al thread actual. Devuelve false si algún ajuste
+    // falló (p. ej. SCHED_FIFO sin permisos); los demás se aplican igualmente.
+    bool ApplyToCurrentThread(const FThreadConfig& config, const std::string& defaultName);
+
+    // Tiempo de CPU consumido por el thread actual en segundos (CLOCK_THREAD_CPUTIME_ID)
+    double GetCurrentThreadCPUTime();
+
+    // Número de CPUs lógicas
+    uint32_t GetNumLogicalCores();
+}
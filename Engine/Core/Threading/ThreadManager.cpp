@@ -1,6 +1,9 @@
 #include "ThreadManager.h"
 #include "RenderCommandQueue.h"
+#include "JobSystem.h"
 #include "../Log.h"
+#include "../Profiler.h"
+#include "../Stats.h"
 #include "../Timer.h"
 #include <chrono>
 
@@ -24,8 +27,21 @@ void ThreadManager::Initialize() {
     mainThreadId = std::this_thread::get_id();
     bShuttingDown = false;
     
-    // Inicializar cola de comandos de renderizado
-    RenderCommandQueue::Get();
+    // Pipeline de frames: el game thread puede ir maxFramesInFlight frames por delante
+    gameFrameNumber = 0;
+    renderFrameNumber = 0;
+    frameSlotSemaphore.Reset(static_cast<int32_t>(maxFramesInFlight) + 1);
+    framesReadySemaphore.Reset(0);
+    
+    // Inicializar cola de comandos de renderizado. Quien bloquee esperando un fence
+    // despierta al render thread aunque no haya frame nuevo.
+    RenderCommandQueue::Get().SetFenceWaitHandler([this]() {
+        framesReadySemaphore.WakeWaiters();
+    });
+    
+    // Iniciar workers antes que game/render thread para que sus ticks puedan repartir trabajo
+    JobSystem::Get().SetWorkerThreadConfig(workerThreadConfig);
+    JobSystem::Get().Initialize(numWorkerThreads);
     
     // Crear game thread
     bGameThreadRunning = true;
@@ -53,6 +69,7 @@ void ThreadManager::Initialize() {
                 std::hash<std::thread::id>{}(renderThreadId));
     
     bInitialized = true;
+    initCondition.notify_all();
     UE_LOG_INFO(LogCategories::Core, "ThreadManager initialized successfully");
 }
 
@@ -68,8 +85,9 @@ void ThreadManager::Shutdown() {
     // Shutdown render command queue
     RenderCommandQueue::Get().Shutdown();
     
-    // Notificar threads para que salgan
-    frameCondition.notify_all();
+    // Desbloquear threads que esperan en el pipeline de frames
+    frameSlotSemaphore.Release(static_cast<int32_t>(MAX_FRAMES_IN_FLIGHT_LIMIT) + 1);
+    framesReadySemaphore.Release(static_cast<int32_t>(MAX_FRAMES_IN_FLIGHT_LIMIT) + 1);
     initCondition.notify_all();
     
     // Esperar a que threads terminen
@@ -83,11 +101,22 @@ void ThreadManager::Shutdown() {
         UE_LOG_INFO(LogCategories::Core, "Render Thread stopped");
     }
     
+    UE_LOG_INFO(LogCategories::Core, "Thread CPU time: game %.3f s, render %.3f s, workers %.3f s",
+                GetThreadCPUTime(EThreadType::Game), GetThreadCPUTime(EThreadType::Render),
+                GetThreadCPUTime(EThreadType::Worker));
+    
+    RenderCommandQueue::Get().SetFenceWaitHandler(nullptr);
+    
+    // Detener workers después de game/render thread (pueden estar esperando jobs)
+    JobSystem::Get().Shutdown();
+    
     bInitialized = false;
     UE_LOG_INFO(LogCategories::Core, "ThreadManager shutdown complete");
 }
 
 void ThreadManager::GameThreadMain() {
+    ThreadUtils::ApplyToCurrentThread(gameThreadConfig, "GameThread");
+    
     // Marcar thread como listo
     {
         std::lock_guard<std::mutex> lock(initMutex);
@@ -95,11 +124,32 @@ void ThreadManager::GameThreadMain() {
     }
     initCondition.notify_all();
     
+    // Esperar a que Initialize termine: los IDs de ambos threads deben estar
+    // asignados antes de que un tick llame IsInGameThread/IsInRenderThread
+    {
+        std::unique_lock<std::mutex> lock(initMutex);
+        initCondition.wait(lock, [this] { return bInitialized.load() || bShuttingDown.load(); });
+    }
+    
     UE_LOG_INFO(LogCategories::Core, "Game Thread main loop started");
     
+    // Los comandos de render del game thread se acumulan sin sincronización y se
+    // vuelcan a la cola una vez por frame
+    FScopedRenderCommandBuffer renderCommandBuffer;
+    
     auto lastTime = std::chrono::high_resolution_clock::now();
+    gameFramePacer.SetTargetFPS(targetGameFPS.load());
+    gameFramePacer.Reset();
     
     while (bGameThreadRunning && !bShuttingDown) {
+        // Esperar slot: bloquea si el render thread va maxFramesInFlight frames por detrás
+        AcquireGameFrameSlot();
+        if (bShuttingDown) {
+            break;
+        }
+        
+        FLogFlightRecorder::MarkFrame("GameThread", gameFrameNumber.load(std::memory_order_relaxed));
+        
         auto currentTime = std::chrono::high_resolution_clock::now();
         float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
         lastTime = currentTime;
@@ -109,35 +159,65 @@ void ThreadManager::GameThreadMain() {
             deltaTime = 0.1f;
         }
         
-        // Ejecutar tick de game thread
-        if (gameThreadTickFunction) {
-            gameThreadTickFunction(deltaTime);
+        {
+            PROFILE_SCOPE("GameThreadTick");
+            
+            // Tareas encoladas con ExecuteInGameThread (antes del tick, para que este vea sus efectos)
+            gameThreadTasks.ExecuteAll();
+            
+            // Ejecutar tick de game thread
+            if (gameThreadTickFunction) {
+                gameThreadTickFunction(deltaTime);
+            }
+            
+            // Volcar los comandos del frame y despertar al render thread una vez por frame
+            // (Enqueue no notifica)
+            RenderCommandQueue::Get().FlushThreadCommands();
+            RenderCommandQueue::Get().NotifyCommandsAvailable();
         }
         
-        // Frame limiting
-        float targetFrameTime = 1.0f / targetGameFPS.load();
-        auto frameEnd = std::chrono::high_resolution_clock::now();
-        float elapsed = std::chrono::duration<float>(frameEnd - currentTime).count();
+        gameThreadCPUTime.store(ThreadUtils::GetCurrentThreadCPUTime(), std::memory_order_relaxed);
         
-        if (elapsed < targetFrameTime) {
-            std::this_thread::sleep_for(
-                std::chrono::duration<float>(targetFrameTime - elapsed)
-            );
-        }
+        // Publicar frame simulado para el render thread
+        gameFrameNumber.fetch_add(1, std::memory_order_acq_rel);
+        framesReadySemaphore.Release();
         
-        // Notificar que frame está listo
-        {
-            std::lock_guard<std::mutex> lock(frameMutex);
-            bFrameReady = true;
-        }
-        frameCondition.notify_one();
+        // El game thread marca los frames de las capturas del profiler y agrega los stats
+        FProfiler::EndFrame();
+        FStats::AdvanceFrame();
+
+        // Frame limiting (deadline absoluto: sleep grueso + spin)
+        gameFramePacer.SetTargetFPS(targetGameFPS.load());
+        gameFramePacer.WaitForNextFrame();
     }
     
     bGameThreadRunning = false;
+    gameThreadCPUTime.store(ThreadUtils::GetCurrentThreadCPUTime(), std::memory_order_relaxed);
+    UE_LOG_INFO(LogCategories::Core, "Game Thread pacing error: avg %.1f us, max %.1f us, %llu missed deadlines",
+                gameFramePacer.GetAverageErrorUS(), gameFramePacer.GetMaxErrorUS(),
+                static_cast<unsigned long long>(gameFramePacer.GetMissedDeadlines()));
+    
+    // Completar lo que quedó encolado; a partir de aquí ExecuteInGameThread ejecuta inline
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    gameThreadTasks.ExecuteUntilEmpty();
+    
     UE_LOG_INFO(LogCategories::Core, "Game Thread main loop ended");
 }
 
+void ThreadManager::AcquireGameFrameSlot() {
+    // Un render thread esperando un FTaskHandle no puede liberar slots: atender
+    // las tareas mientras tanto en vez de bloquear solo en el semáforo
+    bGameThreadWaitingForSlot.store(true, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!frameSlotSemaphore.AcquireUnless([this] { return !gameThreadTasks.IsEmpty(); })) {
+        gameThreadTasks.ExecuteAll();
+    }
+    bGameThreadWaitingForSlot.store(false, std::memory_order_relaxed);
+}
+
 void ThreadManager::RenderThreadMain() {
+    ThreadUtils::ApplyToCurrentThread(renderThreadConfig, "RenderThread");
+    
     // Marcar thread como listo
     {
         std::lock_guard<std::mutex> lock(initMutex);
@@ -145,11 +225,28 @@ void ThreadManager::RenderThreadMain() {
     }
     initCondition.notify_all();
     
+    // Esperar a que Initialize termine: los IDs de ambos threads deben estar
+    // asignados antes de que un tick llame IsInGameThread/IsInRenderThread
+    {
+        std::unique_lock<std::mutex> lock(initMutex);
+        initCondition.wait(lock, [this] { return bInitialized.load() || bShuttingDown.load(); });
+    }
+    
     UE_LOG_INFO(LogCategories::Core, "Render Thread main loop started");
     
     auto lastTime = std::chrono::high_resolution_clock::now();
+    renderFramePacer.SetTargetFPS(targetRenderFPS.load());
+    renderFramePacer.Reset();
     
     while (bRenderThreadRunning && !bShuttingDown) {
+        // Esperar a que el game thread publique el siguiente frame
+        AcquireRenderFrame();
+        if (bShuttingDown) {
+            break;
+        }
+        
+        FLogFlightRecorder::MarkFrame("RenderThread", renderFrameNumber.load(std::memory_order_relaxed));
+        
         auto currentTime = std::chrono::high_resolution_clock::now();
         float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
         lastTime = currentTime;
@@ -159,30 +256,92 @@ void ThreadManager::RenderThreadMain() {
             deltaTime = 0.1f;
         }
         
-        // Ejecutar tick de render thread
-        if (renderThreadTickFunction) {
-            renderThreadTickFunction(deltaTime);
+        {
+            PROFILE_SCOPE("RenderThreadTick");
+            
+            // Ejecutar comandos de renderizado (los del frame publicado, antes de dibujar)
+            RenderCommandQueue::Get().ExecuteAll();
+            
+            // Ejecutar tick de render thread
+            if (renderThreadTickFunction) {
+                renderThreadTickFunction(deltaTime);
+            }
         }
         
-        // Ejecutar comandos de renderizado
-        RenderCommandQueue::Get().ExecuteAll();
+        renderThreadCPUTime.store(ThreadUtils::GetCurrentThreadCPUTime(), std::memory_order_relaxed);
         
-        // Frame limiting
-        float targetFrameTime = 1.0f / targetRenderFPS.load();
-        auto frameEnd = std::chrono::high_resolution_clock::now();
-        float elapsed = std::chrono::duration<float>(frameEnd - currentTime).count();
+        // Frame dibujado: liberar un slot para que el game thread avance
+        renderFrameNumber.fetch_add(1, std::memory_order_acq_rel);
+        frameSlotSemaphore.Release();
         
-        if (elapsed < targetFrameTime) {
-            std::this_thread::sleep_for(
-                std::chrono::duration<float>(targetFrameTime - elapsed)
-            );
-        }
+        // Frame limiting (deadline absoluto: sleep grueso + spin)
+        renderFramePacer.SetTargetFPS(targetRenderFPS.load());
+        renderFramePacer.WaitForNextFrame();
     }
     
     bRenderThreadRunning = false;
+    renderThreadCPUTime.store(ThreadUtils::GetCurrentThreadCPUTime(), std::memory_order_relaxed);
+    UE_LOG_INFO(LogCategories::Core, "Render Thread pacing error: avg %.1f us, max %.1f us, %llu missed deadlines",
+                renderFramePacer.GetAverageErrorUS(), renderFramePacer.GetMaxErrorUS(),
+                static_cast<unsigned long long>(renderFramePacer.GetMissedDeadlines()));
     UE_LOG_INFO(LogCategories::Core, "Render Thread main loop ended");
 }
 
+void ThreadManager::SetMaxFramesInFlight(uint32_t frames) {
+    if (bInitialized) {
+        UE_LOG_WARNING(LogCategories::Core, "SetMaxFramesInFlight must be called before Initialize");
+        return;
+    }
+    
+    if (frames < 1) {
+        frames = 1;
+    } else if (frames > MAX_FRAMES_IN_FLIGHT_LIMIT) {
+        frames = MAX_FRAMES_IN_FLIGHT_LIMIT;
+    }
+    maxFramesInFlight = frames;
+}
+
+void ThreadManager::SetThreadConfig(EThreadType type, const FThreadConfig& config) {
+    if (bInitialized) {
+        UE_LOG_WARNING(LogCategories::Core, "SetThreadConfig must be called before Initialize");
+        return;
+    }
+    
+    switch (type) {
+        case EThreadType::Game:   gameThreadConfig = config; break;
+        case EThreadType::Render: renderThreadConfig = config; break;
+        case EThreadType::Worker: workerThreadConfig = config; break;
+    }
+}
+
+const FThreadConfig& ThreadManager::GetThreadConfig(EThreadType type) const {
+    switch (type) {
+        case EThreadType::Game:   return gameThreadConfig;
+        case EThreadType::Render: return renderThreadConfig;
+        case EThreadType::Worker: return workerThreadConfig;
+    }
+    return gameThreadConfig;
+}
+
+double ThreadManager::GetThreadCPUTime(EThreadType type) const {
+    switch (type) {
+        case EThreadType::Game:   return gameThreadCPUTime.load(std::memory_order_relaxed);
+        case EThreadType::Render: return renderThreadCPUTime.load(std::memory_order_relaxed);
+        case EThreadType::Worker: return JobSystem::Get().GetTotalWorkerCPUTime();
+    }
+    return 0.0;
+}
+
+void ThreadManager::AcquireRenderFrame() {
+    // Alguien esperando un FRenderCommandFence (p. ej. el game thread a mitad de tick)
+    // no puede publicar el frame: ejecutar los comandos sin esperar al frame
+    RenderCommandQueue& renderQueue = RenderCommandQueue::Get();
+    while (!framesReadySemaphore.AcquireUnless([&renderQueue] { return renderQueue.HasFenceWaiters(); })) {
+        renderQueue.ExecuteAll();
+        std::this_thread::yield();
+    }
+}
+
 bool ThreadManager::IsInGameThread() const {
     return std::this_thread::get_id() == gameThreadId;
 }
@@ -191,15 +350,33 @@ bool ThreadManager::IsInRenderThread() const {
     return std::this_thread::get_id() == renderThreadId;
 }
 
-void ThreadManager::ExecuteInGameThread(std::function<void()> function) {
-    if (IsInGameThread()) {
-        function();
-    } else {
-        // Encolar para ejecutar en game thread
-        // Por ahora, ejecutar inmediatamente si no estamos en game thread
-        // (en implementación completa, usaría una cola de comandos de game thread)
+FTaskHandle ThreadManager::ExecuteInGameThread(std::function<void()> function) {
+    if (IsInGameThread() || !bGameThreadRunning) {
         function();
+        return FTaskHandle::MakeCompleted();
     }
+    
+    FTaskHandle handle = FTaskHandle::Make();
+    gameThreadTasks.Enqueue([function = std::move(function), handle]() {
+        try {
+            function();
+        } catch (...) {
+            handle.Complete();
+            throw;
+        }
+        handle.Complete();
+    });
+    
+    // Pareja del fence al final de GameThreadMain: o el game thread ve la tarea,
+    // o aquí se ve que ya terminó y se vacía la cola en este thread
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!bGameThreadRunning) {
+        gameThreadTasks.ExecuteUntilEmpty();
+    } else if (bGameThreadWaitingForSlot.load(std::memory_order_relaxed)) {
+        frameSlotSemaphore.WakeWaiters();
+    }
+    
+    return handle;
 }
 
 void ThreadManager::ExecuteInRenderThread(std::function<void()> function) {
@@ -207,7 +384,7 @@ void ThreadManager::ExecuteInRenderThread(std::function<void()> function) {
         function();
     } else {
         // Encolar en render command queue
-        RenderCommandQueue::Get().Enqueue(ERenderCommandType::Custom, function);
+        RenderCommandQueue::Get().Enqueue(ERenderCommandType::Custom, std::move(function));
     }
 }
 
@@ -1,24 +1,46 @@
 #pragma once
 
+#include "CountingSemaphore.h"
+#include "CommandQueue.h"
+#include "InlineCommand.h"
+#include "TaskHandle.h"
+#include "ThreadConfig.h"
+#include "../Timer.h"
 #include <thread>
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
+#include <cstdint>
 
 // ============================================================================
 // ThreadManager - Gestión de threads del motor (Game Thread, Render Thread)
 // Similar a Unreal Engine's threading system
+// También inicia/detiene el JobSystem (workers con work-stealing)
+//
+// Frames en pipeline: el game thread simula el frame N+1 mientras el render
+// thread dibuja el frame N. El game thread puede adelantarse como máximo
+// GetMaxFramesInFlight() frames (1-3); un semáforo contador lo bloquea si no.
+//
+// ExecuteInGameThread encola en una cola lock-free (TCommandQueue) que el game
+// thread vacía al inicio de cada tick, antes de gameThreadTickFunction.
 // ============================================================================
 
+// Capacidad del ring de tareas del game thread (potencia de 2)
+constexpr size_t GAME_THREAD_TASK_RING_CAPACITY = 1024;
+
 enum class EThreadType {
     Game,
-    Render
+    Render,
+    Worker
 };
 
 class ThreadManager {
 public:
+    // Adelanto máximo permitido del game thread sobre el render thread
+    static constexpr uint32_t MAX_FRAMES_IN_FLIGHT_LIMIT = 3;
+    
     static ThreadManager& Get();
     
     // Inicializar threads
@@ -31,8 +53,10 @@ public:
     bool IsInGameThread() const;
     bool IsInRenderThread() const;
     
-    // Ejecutar función en game thread
-    void ExecuteInGameThread(std::function<void()> function);
+    // Ejecutar función en game thread (al inicio de su próximo tick).
+    // Desde el game thread, o si no está corriendo, se ejecuta inmediatamente.
+    // El handle permite esperar (Wait) o consultar (IsComplete) sin locks.
+    FTaskHandle ExecuteInGameThread(std::function<void()> function);
     
     // Ejecutar función en render thread
     void ExecuteInRenderThread(std::function<void()> function);
@@ -57,6 +81,32 @@ public:
     // Configurar FPS targets
     void SetTargetGameFPS(float fps) { targetGameFPS = fps; }
     void SetTargetRenderFPS(float fps) { targetRenderFPS = fps; }
+    
+    // Precisión del frame limiting de cada thread (error de pacing, deadlines perdidos)
+    const FFramePacer& GetGameFramePacer() const { return gameFramePacer; }
+    const FFramePacer& GetRenderFramePacer() const { return renderFramePacer; }
+    
+    // Adelanto máximo del game thread (1-3 frames). Antes de Initialize.
+    void SetMaxFramesInFlight(uint32_t frames);
+    uint32_t GetMaxFramesInFlight() const { return maxFramesInFlight; }
+    
+    // Frame que está simulando el game thread (válido dentro del tick de game)
+    uint64_t GetGameFrameNumber() const { return gameFrameNumber.load(std::memory_order_acquire); }
+    
+    // Frame que está dibujando el render thread (válido dentro del tick de render)
+    uint64_t GetRenderFrameNumber() const { return renderFrameNumber.load(std::memory_order_acquire); }
+    
+    // Número de workers del JobSystem (0 = uno por hardware thread). Antes de Initialize.
+    void SetNumWorkerThreads(uint32_t count) { numWorkerThreads = count; }
+    
+    // Nombre, afinidad y prioridad de cada tipo de thread. Antes de Initialize.
+    // Nombres por defecto: "GameThread", "RenderThread", "Worker <índice>".
+    void SetThreadConfig(EThreadType type, const FThreadConfig& config);
+    const FThreadConfig& GetThreadConfig(EThreadType type) const;
+    
+    // Tiempo de CPU consumido (CLOCK_THREAD_CPUTIME_ID), en segundos.
+    // Game/render se muestrean una vez por frame; Worker es la suma de todos los workers.
+    double GetThreadCPUTime(EThreadType type) const;
 
 private:
     ThreadManager() = default;
@@ -66,6 +116,12 @@ private:
     
     // Funciones de threads
     void GameThreadMain();
+    
+    // Esperar slot de frame atendiendo mientras tanto la cola de tareas del game thread
+    void AcquireGameFrameSlot();
+    
+    // Esperar frame publicado ejecutando mientras tanto comandos si alguien espera un fence
+    void AcquireRenderFrame();
     void RenderThreadMain();
     
     // Callbacks (configurables)
@@ -93,14 +149,34 @@ private:
     std::atomic<bool> bGameThreadReady{false};
     std::atomic<bool> bRenderThreadReady{false};
     
-    // Frame sync
-    std::mutex frameMutex;
-    std::condition_variable frameCondition;
-    std::atomic<bool> bFrameReady{false};
+    // Frame pipelining
+    // frameSlotSemaphore: frames que el game thread aún puede empezar (maxFramesInFlight + 1)
+    // framesReadySemaphore: frames simulados pendientes de dibujar
+    FCountingSemaphore frameSlotSemaphore;
+    FCountingSemaphore framesReadySemaphore;
+    std::atomic<uint64_t> gameFrameNumber{0};
+    std::atomic<uint64_t> renderFrameNumber{0};
+    uint32_t maxFramesInFlight = 1;
+    
+    // Tareas para el game thread (ExecuteInGameThread)
+    TCommandQueue<FInlineCommand> gameThreadTasks{GAME_THREAD_TASK_RING_CAPACITY};
+    std::atomic<bool> bGameThreadWaitingForSlot{false};
     
     // FPS control
     std::atomic<float> targetGameFPS{60.0f};
     std::atomic<float> targetRenderFPS{60.0f};
+    FFramePacer gameFramePacer;
+    FFramePacer renderFramePacer;
+    
+    // Configuración y tiempo de CPU por thread
+    FThreadConfig gameThreadConfig;
+    FThreadConfig renderThreadConfig;
+    FThreadConfig workerThreadConfig;
+    std::atomic<double> gameThreadCPUTime{0.0};
+    std::atomic<double> renderThreadCPUTime{0.0};
+    
+    // Job system
+    uint32_t numWorkerThreads = 0;
 };
 
 // Macros útiles para verificar thread
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "MPSCRingBuffer.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// ============================================================================
+// TWorkStealingDeque - Deque Chase-Lev acotado (versión C11 de Lê et al. 2013)
+// El thread dueño hace Push/Pop por abajo (LIFO); cualquier otro thread puede
+// hacer Steal por arriba (FIFO). T debe ser trivialmente copiable (p.ej. un puntero).
+// ============================================================================
+
+template<typename T>
+class TWorkStealingDeque {
+public:
+    explicit TWorkStealingDeque(int64_t requestedCapacity)
+        : capacity(RoundUpToPowerOfTwo(requestedCapacity))
+        , mask(capacity - 1)
+        , buffer(new std::atomic<T>[capacity])
+    {
+    }
+
+    TWorkStealingDeque(const TWorkStealingDeque&) = delete;
+    TWorkStealingDeque& operator=(const TWorkStealingDeque&) = delete;
+
+    // Solo el dueño. Devuelve false si el deque está lleno.
+    bool Push(T item) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= capacity) {
+            return false;
+        }
+
+        buffer[b & mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Solo el dueño. Toma el elemento más reciente.
+    bool Pop(T& out) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Vacío
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        T item = buffer[b & mask].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Último elemento: competir con los ladrones
+            bool bWon = top.compare_exchange_strong(t, t + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            if (!bWon) {
+                return false;
+            }
+        }
+
+        out = item;
+        return true;
+    }
+
+    // Cualquier thread. Toma el elemento más antiguo.
+    bool Steal(T& out) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+
+        if (t >= b) {
+            return false;
+        }
+
+        T item = buffer[t & mask].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+            // Otro thread lo tomó primero
+            return false;
+        }
+
+        out = item;
+        return true;
+    }
+
+    // Tamaño aproximado
+    int64_t SizeApprox() const {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+
+private:
+    static int64_t RoundUpToPowerOfTwo(int64_t value) {
+        int64_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const int64_t capacity;
+    const int64_t mask;
+    std::unique_ptr<std::atomic<T>[]> buffer;
+
+    // Ladrones (top) y dueño (bottom) en líneas de caché distintas
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom{0};
+};
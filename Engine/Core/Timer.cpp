@@ -3,6 +3,11 @@
 #include <cmath>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
 
 // Global frame timer
 FFrameTimer* GFrameTimer = nullptr;
@@ -33,6 +38,115 @@ bool FTimer::HasTimeElapsed(double seconds) const {
     return GetElapsedTime() >= seconds;
 }
 
+// ============================================================================
+// FFramePacer Implementation
+// ============================================================================
+
+FFramePacer::FFramePacer(float targetFPS)
+    : targetFPS(0.0f)
+    , framePeriod(Clock::duration::zero())
+    , spinThreshold(DEFAULT_SPIN_THRESHOLD_SECONDS)
+    , sleepOvershoot(0.0)
+{
+    SetTargetFPS(targetFPS);
+    Reset();
+}
+
+void FFramePacer::SetTargetFPS(float newTargetFPS) {
+    if (newTargetFPS == targetFPS) {
+        return;
+    }
+    
+    targetFPS = newTargetFPS;
+    if (targetFPS > 0.0f) {
+        framePeriod = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / targetFPS));
+    } else {
+        framePeriod = Clock::duration::zero();
+    }
+    Reset();
+}
+
+void FFramePacer::Reset() {
+    nextDeadline = Clock::now();
+}
+
+void FFramePacer::WaitForNextFrame() {
+    if (framePeriod <= Clock::duration::zero()) {
+        return;
+    }
+    
+    nextDeadline += framePeriod;
+    
+    auto now = Clock::now();
+    if (now >= nextDeadline) {
+        // Frame took longer than its budget
+        missedDeadlines.fetch_add(1, std::memory_order_relaxed);
+        DecaySleepOvershoot();
+        
+        // More than a whole frame behind: re-anchor instead of rushing to catch up
+        if (now - nextDeadline > framePeriod) {
+            nextDeadline = now;
+        }
+        return;
+    }
+    
+    // Coarse sleep up to the spin margin before the deadline. The margin grows with the
+    // oversleep observed on this machine (capped at half a frame) so we rarely wake late.
+    const double maxSpinMargin = std::chrono::duration<double>(framePeriod).count() * 0.5;
+    double spinMargin = std::min(std::max(spinThreshold, sleepOvershoot * 1.25), maxSpinMargin);
+    auto spinStart = nextDeadline - std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(spinMargin));
+    if (now < spinStart) {
+        std::this_thread::sleep_until(spinStart);
+        
+        // Track oversleep: rise immediately, decay slowly (EMA over ~32 sleeps). A single
+        // long stall counts as no more than the margin cap, so it is forgotten in a few dozen frames.
+        double overshoot = std::min(std::chrono::duration<double>(Clock::now() - spinStart).count(),
+                                    maxSpinMargin);
+        if (overshoot > sleepOvershoot) {
+            sleepOvershoot = overshoot;
+        } else {
+            sleepOvershoot += (overshoot - sleepOvershoot) / 32.0;
+        }
+    } else {
+        // Too little slack to sleep: no new sample, keep decaying anyway
+        DecaySleepOvershoot();
+    }
+    
+    // Spin the rest
+    while ((now = Clock::now()) < nextDeadline) {
+        TimeUtils::CpuRelax();
+    }
+    
+    RecordError(std::chrono::duration<double, std::micro>(now - nextDeadline).count());
+}
+
+void FFramePacer::DecaySleepOvershoot() {
+    // Same rate as the EMA with a zero sample: without it, a large estimate would stop
+    // the pacer from sleeping and never get a sample to shrink it
+    sleepOvershoot -= sleepOvershoot / 32.0;
+}
+
+void FFramePacer::RecordError(double errorUS) {
+    lastErrorUS.store(errorUS, std::memory_order_relaxed);
+    
+    // Exponential moving average (~64 frames)
+    double average = averageErrorUS.load(std::memory_order_relaxed);
+    averageErrorUS.store(average + (errorUS - average) / 64.0, std::memory_order_relaxed);
+    
+    if (errorUS > maxErrorUS.load(std::memory_order_relaxed)) {
+        maxErrorUS.store(errorUS, std::memory_order_relaxed);
+    }
+}
+
+void FFramePacer::ResetStats() {
+    lastErrorUS.store(0.0, std::memory_order_relaxed);
+    averageErrorUS.store(0.0, std::memory_order_relaxed);
+    maxErrorUS.store(0.0, std::memory_order_relaxed);
+    missedDeadlines.store(0, std::memory_order_relaxed);
+}
+
 // ============================================================================
 // FFrameTimer Implementation
 // ============================================================================
@@ -45,6 +159,7 @@ FFrameTimer::FFrameTimer()
     , frameCount(0)
     , targetFPS(60.0f)
     , bFrameLimiting(false)
+    , framePacer(60.0f)
     , fpsHistoryIndex(0)
 {
     startTime = std::chrono::high_resolution_clock::now();
@@ -63,6 +178,12 @@ void FFrameTimer::Tick() {
     auto elapsed = std::chrono::duration<double>(currentTime - lastFrameTime);
     deltaTime = elapsed.count();
     
+    // Statistics use the real frame time: the clamp below would hide the worst hitches.
+    // The first tick measures the time since construction, not a frame.
+    if (frameCount > 0) {
+        frameStats.AddFrame(deltaTime);
+    }
+    
     // Clamp delta time to prevent huge spikes (e.g., when debugging)
     const double MAX_DELTA_TIME = 0.1; // 100ms max
     if (deltaTime > MAX_DELTA_TIME) {
@@ -117,15 +238,7 @@ void FFrameTimer::LimitFrameRate() {
         return;
     }
     
-    double targetFrameTime = 1.0 / targetFPS;
-    double elapsed = GetDeltaTime();
-    
-    if (elapsed < targetFrameTime) {
-        double sleepTime = (targetFrameTime - elapsed) * 1000.0; // Convert to ms
-        if (sleepTime > 0.0) {
-            TimeUtils::SleepMS(static_cast<uint32_t>(sleepTime));
-        }
-    }
+    framePacer.WaitForNextFrame();
 }
 
 std::string FFrameTimer::GetStatsString() const {
@@ -135,6 +248,15 @@ std::string FFrameTimer::GetStatsString() const {
        << " | Delta: " << (deltaTime * 1000.0) << "ms"
        << " | Frame: " << frameCount
        << " | Time: " << std::setprecision(2) << totalTime << "s";
+    if (bFrameLimiting) {
+        ss << " | Pacing: " << std::setprecision(1) << framePacer.GetAverageErrorUS() << "us";
+    }
+    
+    FFrameTimeSummary window = frameStats.GetWindowSummary();
+    if (window.frameCount > 0) {
+        ss << std::setprecision(2) << " | p99: " << window.p99MS << "ms"
+           << " | Hitches: " << window.hitchCount;
+    }
     return ss.str();
 }
 
@@ -211,6 +333,14 @@ void SleepMS(uint32_t milliseconds) {
     std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
 }
 
+void CpuRelax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
 double GetTimeSinceEpoch() {
     auto now = std::chrono::system_clock::now();
     auto duration = now.time_since_epoch();
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <string>
+#include "FrameStats.h"
 #include "Log.h"
 
 // Timer class (similar to UE5's timing utilities)
@@ -29,6 +31,60 @@ private:
     TimePoint startTime;
 };
 
+// Frame pacer - waits until the next frame deadline on an absolute timeline
+// Sleeps coarsely (the OS oversleeps by 50-1000us) and spin-waits the rest, so
+// frame boundaries land within a few microseconds of the deadline. Deadlines are
+// advanced by a fixed period, so errors do not accumulate over time.
+class FFramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+    
+    // Minimum time left before the deadline at which we stop sleeping and start
+    // spinning (raised automatically if the OS oversleeps more than this)
+    static constexpr double DEFAULT_SPIN_THRESHOLD_SECONDS = 0.002;
+    
+    explicit FFramePacer(float targetFPS = 60.0f);
+    
+    // Set target FPS (0 disables pacing). Re-anchors the timeline if it changes.
+    void SetTargetFPS(float targetFPS);
+    float GetTargetFPS() const { return targetFPS; }
+    
+    void SetSpinThreshold(double seconds) { spinThreshold = seconds; }
+    double GetSpinThreshold() const { return spinThreshold; }
+    
+    // Restart the timeline at the current time (e.g. at the start of a loop)
+    void Reset();
+    
+    // Block until the next frame deadline (call once per frame, at the end)
+    void WaitForNextFrame();
+    
+    // Pacing statistics (safe to read from any thread)
+    // Error = actual wake time - deadline, in microseconds
+    double GetLastErrorUS() const { return lastErrorUS.load(std::memory_order_relaxed); }
+    double GetAverageErrorUS() const { return averageErrorUS.load(std::memory_order_relaxed); }
+    double GetMaxErrorUS() const { return maxErrorUS.load(std::memory_order_relaxed); }
+    
+    // Frames that finished after their deadline (no waiting possible)
+    uint64_t GetMissedDeadlines() const { return missedDeadlines.load(std::memory_order_relaxed); }
+    
+    void ResetStats();
+
+private:
+    void RecordError(double errorUS);
+    void DecaySleepOvershoot();  // Frames without a sleep sample
+    
+    float targetFPS;
+    Clock::duration framePeriod;
+    Clock::time_point nextDeadline;
+    double spinThreshold;
+    double sleepOvershoot;  // Estimated sleep_until overshoot in seconds
+    
+    std::atomic<double> lastErrorUS{0.0};
+    std::atomic<double> averageErrorUS{0.0};
+    std::atomic<double> maxErrorUS{0.0};
+    std::atomic<uint64_t> missedDeadlines{0};
+};
+
 // Frame timer - tracks frame delta time and FPS
 class FFrameTimer {
 public:
@@ -56,16 +112,23 @@ public:
     uint64_t GetFrameCount() const { return frameCount; }
     
     // Set target FPS (for frame limiting)
-    void SetTargetFPS(float targetFPS) { this->targetFPS = targetFPS; }
+    void SetTargetFPS(float targetFPS) { this->targetFPS = targetFPS; framePacer.SetTargetFPS(targetFPS); }
     float GetTargetFPS() const { return targetFPS; }
     
     // Enable/disable frame limiting
     void SetFrameLimiting(bool enabled) { bFrameLimiting = enabled; }
     bool IsFrameLimitingEnabled() const { return bFrameLimiting; }
     
-    // Limit frame rate (call at end of frame)
+    // Limit frame rate (call at end of frame). Uses FFramePacer.
     void LimitFrameRate();
     
+    // Frame pacer used by LimitFrameRate (pacing error statistics)
+    const FFramePacer& GetFramePacer() const { return framePacer; }
+    
+    // Frame time percentiles and hitches (unclamped frame times, first frame excluded)
+    const FFrameStats& GetFrameStats() const { return frameStats; }
+    FFrameStats& GetFrameStats() { return frameStats; }
+    
     // Get statistics string
     std::string GetStatsString() const;
 
@@ -80,6 +143,8 @@ private:
     
     float targetFPS;
     bool bFrameLimiting;
+    FFramePacer framePacer;
+    FFrameStats frameStats;
     
     std::chrono::high_resolution_clock::time_point lastFrameTime;
     std::chrono::high_resolution_clock::time_point startTime;
@@ -136,6 +201,9 @@ namespace TimeUtils {
     // Sleep for specified milliseconds
     void SleepMS(uint32_t milliseconds);
     
+    // CPU hint for spin-wait loops (_mm_pause on x86, yield on ARM)
+    void CpuRelax();
+    
     // Get current time in seconds since epoch
     double GetTimeSinceEpoch();
     
@@ -0,0 +1,129 @@
+#include "GpuTimer.h"
+#include "../Core/Log.h"
+
+bool FGpuTimer::Initialize(VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamilyIndex,
+                           uint32_t framesInFlight) {
+    Shutdown();
+
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+    uint32_t validBits = queueFamilyIndex < queueFamilyCount ? queueFamilies[queueFamilyIndex].timestampValidBits : 0;
+    if (validBits == 0) {
+        UE_LOG_WARNING(LogCategories::RHI, "GPU timer disabled: queue family %u does not support timestamps",
+                       queueFamilyIndex);
+        return false;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    timestampPeriodNS = properties.limits.timestampPeriod;
+    timestampMask = validBits >= 64 ? ~0ull : ((1ull << validBits) - 1);
+
+    VkQueryPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    poolInfo.queryCount = framesInFlight * MAX_SCOPES_PER_FRAME * 2;
+
+    if (vkCreateQueryPool(device, &poolInfo, nullptr, &queryPool) != VK_SUCCESS) {
+        UE_LOG_WARNING(LogCategories::RHI, "GPU timer disabled: failed to create the timestamp query pool");
+        queryPool = VK_NULL_HANDLE;
+        return false;
+    }
+
+    this->device = device;
+    frames.assign(framesInFlight, FFrameQueries());
+    for (FFrameQueries& frame : frames) {
+        frame.scopes.reserve(MAX_SCOPES_PER_FRAME);
+    }
+    queryResults.resize(MAX_SCOPES_PER_FRAME * 2);
+    lastResults.reserve(MAX_SCOPES_PER_FRAME);
+
+    UE_LOG_INFO(LogCategories::RHI, "GPU timer initialized (%u valid timestamp bits, %.3f ns per tick)",
+                validBits, timestampPeriodNS);
+    return true;
+}
+
+void FGpuTimer::Shutdown() {
+    if (queryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(device, queryPool, nullptr);
+        queryPool = VK_NULL_HANDLE;
+    }
+    frames.clear();
+    lastResults.clear();
+}
+
+void FGpuTimer::CollectResults(uint32_t frameIndex) {
+    if (!IsSupported() || frameIndex >= frames.size()) {
+        return;
+    }
+
+    FFrameQueries& frame = frames[frameIndex];
+    if (!frame.bPending || frame.scopes.empty()) {
+        frame.bPending = false;
+        return;
+    }
+    frame.bPending = false;
+
+    // Sin WAIT: el fence ya señalizó, y si el command buffer nunca llegó a enviarse
+    // (error al grabar) devuelve VK_NOT_READY en vez de bloquear
+    uint32_t queryCount = static_cast<uint32_t>(frame.scopes.size()) * 2;
+    VkResult result = vkGetQueryPoolResults(device, queryPool, frameIndex * MAX_SCOPES_PER_FRAME * 2, queryCount,
+                                            queryCount * sizeof(uint64_t), queryResults.data(), sizeof(uint64_t),
+                                            VK_QUERY_RESULT_64_BIT);
+    if (result != VK_SUCCESS) {
+        return;
+    }
+
+    lastResults.clear();
+    for (size_t i = 0; i < frame.scopes.size(); i++) {
+        uint64_t ticks = (queryResults[i * 2 + 1] - queryResults[i * 2]) & timestampMask;
+        double nanoseconds = static_cast<double>(ticks) * timestampPeriodNS;
+
+        const FStatDescriptor& stat = *frame.scopes[i];
+        FStats::AddCycles(stat, static_cast<int64_t>(nanoseconds));
+        lastResults.push_back({stat.GetName(), nanoseconds / 1000000.0});
+    }
+}
+
+void FGpuTimer::BeginFrame(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+    if (!IsSupported() || frameIndex >= frames.size()) {
+        return;
+    }
+
+    recordingFrame = frameIndex;
+    FFrameQueries& frame = frames[frameIndex];
+    frame.scopes.clear();
+    frame.bPending = true;
+    vkCmdResetQueryPool(commandBuffer, queryPool, frameIndex * MAX_SCOPES_PER_FRAME * 2, MAX_SCOPES_PER_FRAME * 2);
+}
+
+uint32_t FGpuTimer::BeginScope(VkCommandBuffer commandBuffer, const FStatDescriptor& stat) {
+    if (!IsSupported() || recordingFrame >= frames.size()) {
+        return INVALID_SCOPE;
+    }
+
+    FFrameQueries& frame = frames[recordingFrame];
+    if (frame.scopes.size() >= MAX_SCOPES_PER_FRAME) {
+        UE_LOG_ONCE(LogCategories::RHI, Warning, "GPU timer: more than %u scopes in a frame, the rest are ignored",
+                    MAX_SCOPES_PER_FRAME);
+        return INVALID_SCOPE;
+    }
+
+    uint32_t scope = static_cast<uint32_t>(frame.scopes.size());
+    frame.scopes.push_back(&stat);
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool,
+                        (recordingFrame * MAX_SCOPES_PER_FRAME + scope) * 2);
+    return scope;
+}
+
+void FGpuTimer::EndScope(VkCommandBuffer commandBuffer, uint32_t scope) {
+    if (scope == INVALID_SCOPE) {
+        return;
+    }
+
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool,
+                        (recordingFrame * MAX_SCOPES_PER_FRAME + scope) * 2 + 1);
+}
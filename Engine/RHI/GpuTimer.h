@@ -0,0 +1,97 @@
+#pragma once
+
+#define GLFW_INCLUDE_VULKAN
+#include <GLFW/glfw3.h>
+#include "../Core/Stats.h"
+
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// FGpuTimer - Tiempos de GPU con timestamp queries (como los GPU stats de UE5)
+// ============================================================================
+//
+// Cada frame en vuelo tiene su propio rango de queries en un único query pool.
+// Un scope escribe un timestamp al empezar y otro al terminar; los resultados se
+// leen sin bloquear cuando el fence de ese frame ya señalizó (el frame retirado),
+// y cada scope suma su duración al cycle stat indicado, así aparece en StatsPanel
+// y DebugOverlay junto con los tiempos de CPU.
+//
+// Si la cola no soporta timestamps (timestampValidBits == 0) todo es no-op.
+// Solo usa Vulkan 1.0 core (vkCmdResetQueryPool), así que funciona en lavapipe.
+
+struct FGpuTimerResult {
+    const char* name;
+    double milliseconds;
+};
+
+class FGpuTimer {
+public:
+    static constexpr uint32_t MAX_SCOPES_PER_FRAME = 16;
+    static constexpr uint32_t INVALID_SCOPE = ~0u;
+
+    bool Initialize(VkPhysicalDevice physicalDevice, VkDevice device, uint32_t queueFamilyIndex,
+                    uint32_t framesInFlight);
+    void Shutdown();
+
+    bool IsSupported() const { return queryPool != VK_NULL_HANDLE; }
+
+    // Leer los resultados del último uso de este frame. Llamar después de esperar su fence.
+    void CollectResults(uint32_t frameIndex);
+
+    // Resetear las queries del frame. Llamar al empezar a grabar, fuera de un render pass.
+    void BeginFrame(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+    uint32_t BeginScope(VkCommandBuffer commandBuffer, const FStatDescriptor& stat);
+    void EndScope(VkCommandBuffer commandBuffer, uint32_t scope);
+
+    // Duraciones del último frame retirado, en orden de apertura de los scopes
+    const std::vector<FGpuTimerResult>& GetLastResults() const { return lastResults; }
+
+private:
+    struct FFrameQueries {
+        std::vector<const FStatDescriptor*> scopes;
+        bool bPending = false;  // Grabado y todavía no leído
+    };
+
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueryPool queryPool = VK_NULL_HANDLE;
+    double timestampPeriodNS = 1.0;     // Nanosegundos por tick
+    uint64_t timestampMask = ~0ull;     // Bits válidos de los timestamps
+
+    std::vector<FFrameQueries> frames;
+    uint32_t recordingFrame = 0;
+    std::vector<uint64_t> queryResults;
+    std::vector<FGpuTimerResult> lastResults;
+};
+
+// Par de timestamps alrededor de un scope del command buffer (RAII)
+class FGpuTimerScope {
+public:
+    FGpuTimerScope(FGpuTimer& timer, VkCommandBuffer commandBuffer, const FStatDescriptor& stat)
+        : timer(timer)
+        , commandBuffer(commandBuffer)
+        , scope(timer.BeginScope(commandBuffer, stat))
+    {
+    }
+
+    ~FGpuTimerScope() {
+        timer.EndScope(commandBuffer, scope);
+    }
+
+    FGpuTimerScope(const FGpuTimerScope&) = delete;
+    FGpuTimerScope& operator=(const FGpuTimerScope&) = delete;
+
+private:
+    FGpuTimer& timer;
+    VkCommandBuffer commandBuffer;
+    uint32_t scope;
+};
+
+// Los resultados van a un cycle stat: sin stats no hay nada que medir
+#if ENGINE_STATS_ENABLED
+#define SCOPED_GPU_TIMER(Timer, CommandBuffer, StatId) \
+    FGpuTimerScope PROFILE_CONCAT(_gpuTimerScope, __LINE__)(Timer, CommandBuffer, StatId)
+#else
+#define SCOPED_GPU_TIMER(Timer, CommandBuffer, StatId) do { } while (0)
+#endif
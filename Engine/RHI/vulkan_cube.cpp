@@ -1,6 +1,7 @@
 #include "vulkan_cube.h"
 #include "../UI/EGUIWrapper.h"
 #include "../Core/Log.h"
+#include "../Core/Stats.h"
 #include <iostream>
 #include <fstream>
 #include <algorithm>
@@ -10,6 +11,13 @@
 #include <set>
 #include <cmath>
 
+DECLARE_CYCLE_STAT("DrawFrame", STAT_DrawFrame, RHI);
+DECLARE_CYCLE_STAT("RecordCommandBuffer", STAT_RecordCommandBuffer, RHI);
+DECLARE_DWORD_COUNTER_STAT("Draw calls", STAT_DrawCalls, RHI);
+DECLARE_MEMORY_COUNTER_STAT("Bytes uploaded", STAT_BytesUploaded, RHI);
+DECLARE_CYCLE_STAT("GPU scene", STAT_GPUScene, GPU);
+DECLARE_CYCLE_STAT("GPU eGUI", STAT_GPUEGUI, GPU);
+
 // Las validation layers son opcionales - solo se usan si están disponibles
 #ifdef NDEBUG
 const bool enableValidationLayers = false;
@@ -94,6 +102,10 @@ static float g_ProjMatrix[16] = {0};
 static bool g_MatricesDirty = true;
 static bool g_UseCameraMatrices = false;
 
+// Model matrix (updated by game thread); if not set, the cube rotates on its own
+static float g_ModelMatrix[16] = {0};
+static bool g_UseModelMatrix = false;
+
 VulkanCube::VulkanCube() {
     window = nullptr;
 }
@@ -128,6 +140,7 @@ void VulkanCube::initVulkan(GLFWwindow* window) {
     createDescriptorSets();
     createCommandBuffers();
     createSyncObjects();
+    createGpuTimer();
 }
 
 void VulkanCube::cleanup() {
@@ -155,6 +168,8 @@ void VulkanCube::cleanup() {
     
     vkDestroyCommandPool(device, commandPool, nullptr);
     
+    gpuTimer.Shutdown();
+    
     vkDestroyDevice(device, nullptr);
     
     if (enableValidationLayers) {
@@ -527,7 +542,7 @@ VkExtent2D VulkanCube::chooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabili
         return capabilities.currentExtent;
     } else {
         int width, height;
-        glfwGetFramebufferSize(window, &width, &height);
+        getFramebufferSize(width, height);
         
         VkExtent2D actualExtent = {
             static_cast<uint32_t>(width),
@@ -833,6 +848,7 @@ void VulkanCube::createVertexBuffer() {
     void* data;
     vkMapMemory(device, stagingBufferMemory, 0, bufferSize, 0, &data);
     memcpy(data, vertices.data(), (size_t) bufferSize);
+    INC_MEMORY_STAT_BY(STAT_BytesUploaded, bufferSize);
     vkUnmapMemory(device, stagingBufferMemory);
     
     createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
@@ -856,6 +872,7 @@ void VulkanCube::createIndexBuffer() {
     void* data;
     vkMapMemory(device, stagingBufferMemory, 0, bufferSize, 0, &data);
     memcpy(data, indices.data(), (size_t) bufferSize);
+    INC_MEMORY_STAT_BY(STAT_BytesUploaded, bufferSize);
     vkUnmapMemory(device, stagingBufferMemory);
     
     createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
@@ -949,6 +966,7 @@ void VulkanCube::createCommandBuffers() {
 }
 
 void VulkanCube::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+    SCOPE_CYCLE_COUNTER(STAT_RecordCommandBuffer);
     VkCommandBufferBeginInfo beginInfo{};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     
@@ -956,6 +974,9 @@ void VulkanCube::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t ima
         throw std::runtime_error("failed to begin recording command buffer!");
     }
     
+    // Reset de las timestamp queries de este frame (no se permite dentro del render pass)
+    gpuTimer.BeginFrame(commandBuffer, static_cast<uint32_t>(currentFrame));
+    
     VkRenderPassBeginInfo renderPassInfo{};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
     renderPassInfo.renderPass = renderPass;
@@ -984,31 +1005,31 @@ void VulkanCube::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t ima
     dynamicScissor.extent = swapChainExtent;
     vkCmdSetScissor(commandBuffer, 0, 1, &dynamicScissor);
     
-    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
-    
-    VkBuffer vertexBuffers[] = {vertexBuffer};
-    VkDeviceSize offsets[] = {0};
-    vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
-    
-    vkCmdBindIndexBuffer(commandBuffer, indexBuffer, 0, VK_INDEX_TYPE_UINT16);
-    
-    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, 
-                            &descriptorSets[currentFrame], 0, nullptr);
-    
-    vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(indices.size()), 1, 0, 0, 0);
+    {
+        SCOPED_GPU_TIMER(gpuTimer, commandBuffer, STAT_GPUScene);
+        
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
+        
+        VkBuffer vertexBuffers[] = {vertexBuffer};
+        VkDeviceSize offsets[] = {0};
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+        
+        vkCmdBindIndexBuffer(commandBuffer, indexBuffer, 0, VK_INDEX_TYPE_UINT16);
+        
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, 
+                                &descriptorSets[currentFrame], 0, nullptr);
+        
+        vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(indices.size()), 1, 0, 0, 0);
+        INC_DWORD_STAT(STAT_DrawCalls);
+    }
     
     // Render eGUI (MUST be inside render pass, before vkCmdEndRenderPass)
-    static uint32_t renderCallCount = 0;
-    renderCallCount++;
     if (UI::EGUIWrapper::Get().IsInitialized()) {
-        if (renderCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[recordCommandBuffer] About to render eGUI (first call)...");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[recordCommandBuffer] About to render eGUI (first call)...");
+        SCOPED_GPU_TIMER(gpuTimer, commandBuffer, STAT_GPUEGUI);
         try {
             UI::EGUIWrapper::Get().Render(commandBuffer, swapChainExtent.width, swapChainExtent.height);
-            if (renderCallCount == 1) {
-                UE_LOG_INFO(LogCategories::RHI, "[recordCommandBuffer] eGUI rendered successfully");
-            }
+            UE_LOG_ONCE(LogCategories::RHI, Log, "[recordCommandBuffer] eGUI rendered successfully");
         } catch (const std::exception& e) {
             UE_LOG_FATAL(LogCategories::RHI, "[recordCommandBuffer] Exception rendering eGUI: %s", e.what());
             throw;
@@ -1023,11 +1044,7 @@ void VulkanCube::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t ima
     // Verificar el estado del command buffer antes de cerrarlo
     VkResult endResult = vkEndCommandBuffer(commandBuffer);
     if (endResult != VK_SUCCESS) {
-        static bool firstError = true;
-        if (firstError) {
-            UE_LOG_FATAL(LogCategories::RHI, "[recordCommandBuffer] vkEndCommandBuffer failed with result %d", endResult);
-            firstError = false;
-        }
+        UE_LOG_FATAL(LogCategories::RHI, "[recordCommandBuffer] vkEndCommandBuffer failed with result %d", endResult);
         throw std::runtime_error("failed to record command buffer!");
     }
 }
@@ -1053,14 +1070,19 @@ void VulkanCube::createSyncObjects() {
     }
 }
 
+void VulkanCube::createGpuTimer() {
+    QueueFamilyIndices indices = findQueueFamilies(physicalDevice);
+    gpuTimer.Initialize(physicalDevice, device, indices.graphicsFamily.value(), MAX_FRAMES_IN_FLIGHT);
+}
+
 void VulkanCube::drawFrame() {
-    // Log entry point for debugging
-    static uint32_t drawFrameCallCount = 0;
-    drawFrameCallCount++;
-    
+    SCOPE_CYCLE_COUNTER(STAT_DrawFrame);
     try {
         vkWaitForFences(device, 1, &inFlightFences[currentFrame], VK_TRUE, UINT64_MAX);
         
+        // El frame que usó este slot ya terminó: sus timestamps se leen sin esperar
+        gpuTimer.CollectResults(static_cast<uint32_t>(currentFrame));
+        
         uint32_t imageIndex;
         VkResult result = vkAcquireNextImageKHR(device, swapChain, UINT64_MAX, 
                                                 imageAvailableSemaphores[currentFrame], VK_NULL_HANDLE, &imageIndex);
@@ -1076,19 +1098,13 @@ void VulkanCube::drawFrame() {
         
         vkResetCommandBuffer(commandBuffers[currentFrame], 0);
         
-        if (drawFrameCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[drawFrame] About to record command buffer...");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[drawFrame] About to record command buffer...");
         recordCommandBuffer(commandBuffers[currentFrame], imageIndex);
-        if (drawFrameCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[drawFrame] Command buffer recorded successfully");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[drawFrame] Command buffer recorded successfully");
         
         updateUniformBuffer(currentFrame);
         
-        if (drawFrameCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[drawFrame] About to submit to graphics queue...");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[drawFrame] About to submit to graphics queue...");
         VkSubmitInfo submitInfo{};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         
@@ -1119,13 +1135,9 @@ void VulkanCube::drawFrame() {
                          (void*)commandBuffers[currentFrame], (void*)inFlightFences[currentFrame]);
             throw std::runtime_error("failed to submit draw command buffer!");
         }
-        if (drawFrameCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[drawFrame] Submitted to graphics queue successfully");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[drawFrame] Submitted to graphics queue successfully");
         
-        if (drawFrameCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[drawFrame] About to present...");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[drawFrame] About to present...");
         VkPresentInfoKHR presentInfo{};
         presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.waitSemaphoreCount = 1;
@@ -1138,15 +1150,13 @@ void VulkanCube::drawFrame() {
         
         result = vkQueuePresentKHR(presentQueue, &presentInfo);
         
-        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || framebufferResized) {
-            framebufferResized = false;
+        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR ||
+            framebufferResized.exchange(false, std::memory_order_acq_rel)) {
             recreateSwapChain();
         } else if (result != VK_SUCCESS) {
             throw std::runtime_error("failed to present swap chain image!");
         }
-        if (drawFrameCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[drawFrame] Present completed successfully");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[drawFrame] Present completed successfully");
         
         currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
         
@@ -1156,9 +1166,7 @@ void VulkanCube::drawFrame() {
             UI::EGUIWrapper::Get().UpdateFontTextureIfNeeded();
         }
         
-        if (drawFrameCallCount == 1) {
-            UE_LOG_INFO(LogCategories::RHI, "[drawFrame] First drawFrame() completed successfully!");
-        }
+        UE_LOG_ONCE(LogCategories::RHI, Log, "[drawFrame] First drawFrame() completed successfully!");
     } catch (const std::exception& e) {
         UE_LOG_FATAL(LogCategories::RHI, "[drawFrame] Exception: %s", e.what());
         throw; // Re-throw to be caught by caller
@@ -1179,6 +1187,15 @@ void VulkanCube::UpdateMatrices(const float* viewMatrix, const float* projMatrix
     g_MatricesDirty = true;
 }
 
+void VulkanCube::UpdateModelMatrix(const float* modelMatrix) {
+    if (modelMatrix) {
+        memcpy(g_ModelMatrix, modelMatrix, sizeof(g_ModelMatrix));
+        g_UseModelMatrix = true;
+    } else {
+        g_UseModelMatrix = false;
+    }
+}
+
 void VulkanCube::updateUniformBuffer(uint32_t currentImage) {
     static auto startTime = std::chrono::high_resolution_clock::now();
     
@@ -1203,7 +1220,7 @@ void VulkanCube::updateUniformBuffer(uint32_t currentImage) {
         sinT,           -sinX * cosT,   cosX * cosT,    0.0f,
         0.0f,           0.0f,           0.0f,           1.0f
     };
-    memcpy(ubo.model, model, sizeof(model));
+    memcpy(ubo.model, g_UseModelMatrix ? g_ModelMatrix : model, sizeof(model));
     
     // Usar matrices de cámara si están actualizadas, sino usar defaults
     if (g_UseCameraMatrices) {
@@ -1234,16 +1251,47 @@ void VulkanCube::updateUniformBuffer(uint32_t currentImage) {
     vkMapMemory(device, uniformBuffersMemory[currentImage], 0, sizeof(ubo), 0, &data);
     memcpy(data, &ubo, sizeof(ubo));
     vkUnmapMemory(device, uniformBuffersMemory[currentImage]);
+    INC_MEMORY_STAT_BY(STAT_BytesUploaded, sizeof(ubo));
+}
+
+void VulkanCube::SetFramebufferSize(int width, int height) {
+    const uint64_t size = (static_cast<uint64_t>(static_cast<uint32_t>(std::max(width, 0))) << 32) |
+                          static_cast<uint32_t>(std::max(height, 0));
+    const uint64_t previousSize = publishedFramebufferSize.exchange(size, std::memory_order_acq_rel);
+    // La primera publicación (tras initVulkan) solo fija el tamaño actual del swap chain
+    if (bFramebufferSizePublished.exchange(true, std::memory_order_acq_rel) && previousSize != size) {
+        framebufferResized.store(true, std::memory_order_release);
+    }
+}
+
+void VulkanCube::getFramebufferSize(int& width, int& height) const {
+    if (bFramebufferSizePublished.load(std::memory_order_acquire)) {
+        const uint64_t size = publishedFramebufferSize.load(std::memory_order_acquire);
+        width = static_cast<int>(size >> 32);
+        height = static_cast<int>(size & 0xFFFFFFFFu);
+        return;
+    }
+    glfwGetFramebufferSize(window, &width, &height);
 }
 
 void VulkanCube::recreateSwapChain() {
     int width = 0, height = 0;
-    glfwGetFramebufferSize(window, &width, &height);
-    
-    // Wait for valid size (e.g., when minimizing)
-    while (width == 0 || height == 0) {
-        glfwGetFramebufferSize(window, &width, &height);
-        glfwWaitEvents();
+    getFramebufferSize(width, height);
+    
+    if (bFramebufferSizePublished.load(std::memory_order_acquire)) {
+        // Posiblemente en el render thread: GLFW (glfwWaitEvents, glfwGetFramebufferSize)
+        // solo se puede usar desde el main thread. Ventana minimizada: reintentar cuando
+        // el main thread publique un tamaño válido.
+        if (width == 0 || height == 0) {
+            framebufferResized.store(true, std::memory_order_release);
+            return;
+        }
+    } else {
+        // Wait for valid size (e.g., when minimizing)
+        while (width == 0 || height == 0) {
+            glfwGetFramebufferSize(window, &width, &height);
+            glfwWaitEvents();
+        }
     }
     
     // Clamp to supported resolution range
@@ -4,8 +4,10 @@
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 #include "../Core/Log.h"
+#include "GpuTimer.h"
 
 #include <vector>
+#include <atomic>
 #include <string>
 #include <optional>
 #include <cstddef>
@@ -54,8 +56,17 @@ public:
     // Update matrices from camera
     void UpdateMatrices(const float* viewMatrix, const float* projMatrix);
     
+    // Update cube model matrix (nullptr = built-in rotation)
+    void UpdateModelMatrix(const float* modelMatrix);
+    
     // Mark framebuffer as resized (called from callback)
-    void MarkFramebufferResized() { framebufferResized = true; }
+    void MarkFramebufferResized() { framebufferResized.store(true, std::memory_order_release); }
+    
+    // Publicar el tamaño del framebuffer desde el main thread (callback de GLFW); si cambió,
+    // el swap chain se recrea en el siguiente drawFrame. A partir de la primera llamada drawFrame no llama a GLFW, así que
+    // puede ejecutarse en el render thread; con 0x0 (ventana minimizada) el swap chain no se
+    // recrea hasta que llegue un tamaño válido.
+    void SetFramebufferSize(int width, int height);
     
     // Getters for ImGui integration
     VkInstance GetInstance() const { return instance; }
@@ -65,6 +76,9 @@ public:
     VkRenderPass GetRenderPass() const { return renderPass; }
     VkDescriptorPool GetDescriptorPool() const { return descriptorPool; }
     uint32_t GetGraphicsQueueFamilyIndex() const;
+    
+    // Tiempos de GPU del último frame retirado (escena y eGUI)
+    const FGpuTimer& GetGpuTimer() const { return gpuTimer; }
 
 private:
     GLFWwindow* window;
@@ -117,7 +131,13 @@ private:
     VkDescriptorPool descriptorPool;
     std::vector<VkDescriptorSet> descriptorSets;
     
-    bool framebufferResized = false;
+    std::atomic<bool> framebufferResized{false};
+    
+    // Tamaño publicado con SetFramebufferSize (ancho en los 32 bits altos)
+    std::atomic<uint64_t> publishedFramebufferSize{0};
+    std::atomic<bool> bFramebufferSizePublished{false};
+    
+    FGpuTimer gpuTimer;
     
     void createInstance();
     void setupDebugMessenger();
@@ -138,6 +158,7 @@ private:
     void createDescriptorSets();
     void createCommandBuffers();
     void createSyncObjects();
+    void createGpuTimer();
     void updateUniformBuffer(uint32_t currentImage);
     
     bool isDeviceSuitable(VkPhysicalDevice device);
@@ -165,6 +186,9 @@ private:
     VkExtent2D chooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities);
     
     void recreateSwapChain();
+    
+    // Tamaño publicado si lo hay; si no, el de GLFW (solo desde el main thread)
+    void getFramebufferSize(int& width, int& height) const;
     void cleanupSwapChain();
     
     uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
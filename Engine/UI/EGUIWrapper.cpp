@@ -1,5 +1,6 @@
 #include "EGUIWrapper.h"
 #include "../Core/Log.h"
+#include "../Core/Stats.h"
 // engine_ui_ffi.h ya está incluido en EGUIWrapper.h
 
 namespace UI {
@@ -57,6 +58,24 @@ bool EGUIWrapper::Initialize(
     return success;
 }
 
+bool EGUIWrapper::InitializeHeadless(uint32_t width, uint32_t height) {
+    if (bInitialized) {
+        UE_LOG_WARNING(LogCategories::UI, "EGUIWrapper already initialized");
+        return true;
+    }
+    
+    // egui_init no usa la ventana ni la instancia
+    if (!egui_init(nullptr, nullptr)) {
+        UE_LOG_ERROR(LogCategories::UI, "Failed to initialize eGUI (headless)");
+        return false;
+    }
+    
+    bInitialized = true;
+    egui_set_screen_size(static_cast<float>(width), static_cast<float>(height));
+    UE_LOG_INFO(LogCategories::UI, "eGUI initialized headless (%ux%u, no renderer)", width, height);
+    return true;
+}
+
 void EGUIWrapper::NewFrame() {
     if (!bInitialized) return;
     egui_new_frame();
@@ -66,15 +85,18 @@ void EGUIWrapper::NewFrame() {
     egui_show_demo();
 }
 
+DECLARE_CYCLE_STAT("EGUIRender", STAT_EGUIRender, UI);
+
 void EGUIWrapper::Render(VkCommandBuffer commandBuffer, uint32_t width, uint32_t height) {
     if (!bInitialized || !engineState) return;
+    SCOPE_CYCLE_COUNTER(STAT_EGUIRender);
     
     // Llamar a la función FFI de Rust para renderizar (genera datos de renderizado)
     // Esta función finaliza el frame y genera los meshes
     bool hasData = egui_render(engineState, commandBuffer);
     
     // SIEMPRE intentar renderizar, incluso si hasData es false
-    // porque puede haber datos de un frame anterior
+    // porque puede haber datos de un frame anterior (headless: no hay renderer)
     if (renderer && renderer->IsInitialized()) {
         renderer->Render(commandBuffer, 0, width, height);
     }
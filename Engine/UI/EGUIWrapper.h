@@ -31,6 +31,10 @@ public:
         uint32_t imageCount
     );
     
+    // Sin ventana ni Vulkan (modo --headless): eGUI construye y tesela la UI cada
+    // frame, pero no hay VulkanRenderer y Render no graba nada
+    bool InitializeHeadless(uint32_t width, uint32_t height);
+    
     // Ciclo de renderizado
     void NewFrame();
     void Render(VkCommandBuffer commandBuffer, uint32_t width, uint32_t height);
@@ -1,6 +1,13 @@
 #include "ConsolePanel.h"
 #include "../../Core/Log.h"
+#include "../../Core/Profiler.h"
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <thread>
 
 namespace UI {
 
@@ -17,16 +24,84 @@ ConsolePanel::ConsolePanel() {
 void ConsolePanel::Render() {
     if (!IsVisible()) return;
     
-    // TODO: Implementar renderizado con eGUI (Rust)
-    // Por ahora es un stub - no renderiza nada
+    // Igual que DebugOverlay: hasta que la consola se dibuje con eGUI (Rust), las
+    // entradas nuevas (incluidas las respuestas a los comandos) se emiten al log
+    size_t firstEntry = logs.size() - std::min(unrenderedEntries, logs.size());
+    for (size_t i = firstEntry; i < logs.size(); i++) {
+        const LogEntry& entry = logs[i];
+        switch (entry.level) {
+            case ELogLevel::Error:
+                UE_LOG_ERROR(LogCategories::UI, "[Console] %s", entry.message.c_str());
+                break;
+            case ELogLevel::Warning:
+                UE_LOG_WARNING(LogCategories::UI, "[Console] %s", entry.message.c_str());
+                break;
+            case ELogLevel::Verbose:
+                UE_LOG_VERBOSE(LogCategories::UI, "[Console] %s", entry.message.c_str());
+                break;
+            case ELogLevel::Info:
+                UE_LOG_DISPLAY(LogCategories::UI, "[Console] %s", entry.message.c_str());
+                break;
+        }
+    }
+    unrenderedEntries = 0;
 }
 
 void ConsolePanel::Update(float deltaTime) {
-    // Update logic
+    // Comandos encolados desde otros threads (terminal)
+    std::vector<std::string> commands;
+    {
+        std::lock_guard<std::mutex> lock(commandInbox->mutex);
+        commands.swap(commandInbox->commands);
+    }
+    for (const std::string& command : commands) {
+        ExecuteCommand(command);
+    }
+}
+
+void ConsolePanel::QueueCommand(const std::string& command) {
+    std::lock_guard<std::mutex> lock(commandInbox->mutex);
+    commandInbox->commands.push_back(command);
+}
+
+void ConsolePanel::SetInputText(const std::string& text) {
+    std::strncpy(inputBuffer, text.c_str(), sizeof(inputBuffer) - 1);
+    inputBuffer[sizeof(inputBuffer) - 1] = '\0';
+}
+
+void ConsolePanel::SubmitInput() {
+    std::string command = inputBuffer;
+    inputBuffer[0] = '\0';
+    ExecuteCommand(command);
+}
+
+void ConsolePanel::StartTerminalInput() {
+    if (bTerminalInputStarted) {
+        return;
+    }
+    bTerminalInputStarted = true;
+    
+    // Detached: std::getline no se puede interrumpir, así que el thread no se une al
+    // salir. Solo comparte el inbox (shared_ptr), nunca el panel.
+    std::shared_ptr<FCommandInbox> inbox = commandInbox;
+    std::thread([inbox] {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            std::lock_guard<std::mutex> lock(inbox->mutex);
+            inbox->commands.push_back(line);
+        }
+    }).detach();
+    
+    AddLog("Console commands are read from the terminal (e.g. \"log LogRender Verbose\", \"profile 120\")",
+           ELogLevel::Info);
 }
 
 void ConsolePanel::AddLog(const std::string& message, ELogLevel level) {
     logs.push_back(LogEntry(message, level, 0.0f)); // Timestamp placeholder
+    unrenderedEntries++;
     
     if (logs.size() > MAX_LOG_ENTRIES) {
         logs.pop_front();
@@ -37,8 +112,76 @@ void ConsolePanel::AddLog(const std::string& message, ELogLevel level) {
     }
 }
 
+void ConsolePanel::ExecuteCommand(const std::string& command) {
+    if (command.empty()) {
+        return;
+    }
+    
+    commandHistory.push_back(command);
+    historyPos = -1;
+    AddLog("> " + command, ELogLevel::Info);
+    
+    // Verbosidad de categorías de log: "log <Categoría> <Verbosidad>[, ...]"
+    if (command.compare(0, 4, "log ") == 0 || command == "log") {
+        std::string arguments = command.size() > 4 ? command.substr(4) : "";
+        if (arguments.empty() || arguments == "list") {
+            std::string description = FLog::DescribeCategories();
+            size_t lineStart = 0;
+            while (lineStart < description.size()) {
+                size_t lineEnd = description.find('\n', lineStart);
+                if (lineEnd == std::string::npos) {
+                    lineEnd = description.size();
+                }
+                AddLog(description.substr(lineStart, lineEnd - lineStart), ELogLevel::Info);
+                lineStart = lineEnd + 1;
+            }
+            return;
+        }
+        
+        std::string error;
+        if (FLog::ApplyLogCommands(arguments, &error)) {
+            AddLog("Log verbosity updated", ELogLevel::Info);
+        } else {
+            AddLog(error, ELogLevel::Error);
+        }
+        return;
+    }
+    
+    // Captura del profiler: "profile <frames> [archivo]" o "profile stop"
+    if (command.compare(0, 8, "profile ") == 0 || command == "profile") {
+        std::istringstream arguments(command.substr(command.size() > 8 ? 8 : command.size()));
+        std::string first;
+        std::string outputFile = "Engine.trace.json";
+        arguments >> first >> outputFile;
+        
+        if (first == "stop") {
+            if (!FProfiler::StopCapture()) {
+                AddLog("No profiler capture is running", ELogLevel::Warning);
+            }
+            return;
+        }
+        
+        unsigned long frameCount = first.empty() ? 0 : std::strtoul(first.c_str(), nullptr, 10);
+        if (frameCount == 0) {
+            AddLog("Usage: profile <frames> [file] | profile stop", ELogLevel::Warning);
+        } else if (FProfiler::StartCapture(static_cast<uint32_t>(frameCount), outputFile)) {
+            AddLog("Profiling " + std::to_string(frameCount) + " frames to " + outputFile, ELogLevel::Info);
+        } else {
+            AddLog("A profiler capture is already running", ELogLevel::Warning);
+        }
+        return;
+    }
+    
+    if (commandCallback) {
+        commandCallback(command);
+    } else {
+        AddLog("Unknown command: " + command, ELogLevel::Warning);
+    }
+}
+
 void ConsolePanel::ClearLogs() {
     logs.clear();
+    unrenderedEntries = 0;
 }
 
 void ConsolePanel::RenderToolbar() {
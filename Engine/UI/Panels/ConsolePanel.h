@@ -1,9 +1,12 @@
 #pragma once
 
 #include "../UIBase.h"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
-#include <deque>
 
 // Forward declarations
 
@@ -47,12 +50,42 @@ public:
     void SetShowErrors(bool show) { bShowErrors = show; }
     void SetShowVerbose(bool show) { bShowVerbose = show; }
     
+    // Ejecutar un comando de la consola. "log ..." ("log LogRender Verbose, LogRHI off",
+    // "log list", "log reset") y "profile ..." ("profile 120 [archivo]", "profile stop")
+    // se procesan aquí; el resto se pasa al command callback.
+    void ExecuteCommand(const std::string& command);
+    
+    // Encolar un comando desde cualquier thread; se ejecuta en el siguiente Update
+    void QueueCommand(const std::string& command);
+    
+    // Ejecutar lo escrito en la línea de entrada (Enter en la consola) y vaciarla
+    void SubmitInput();
+    void SetInputText(const std::string& text);
+    
+    // Leer comandos de la terminal (stdin), una línea por comando, mientras el panel
+    // no tenga entrada de texto propia en eGUI. El thread termina con EOF.
+    void StartTerminalInput();
+    
     // Command input
     void SetCommandCallback(std::function<void(const std::string&)> callback) {
         commandCallback = callback;
     }
+    
+    const std::deque<LogEntry>& GetLogs() const { return logs; }
 
 private:
+    // Comandos encolados por otros threads (compartido con el lector de stdin, que
+    // puede sobrevivir al panel)
+    struct FCommandInbox {
+        std::mutex mutex;
+        std::vector<std::string> commands;
+    };
+    std::shared_ptr<FCommandInbox> commandInbox = std::make_shared<FCommandInbox>();
+    bool bTerminalInputStarted = false;
+    
+    // Entradas añadidas desde el último Render (se emiten al log)
+    size_t unrenderedEntries = 0;
+
     std::deque<LogEntry> logs;
     static const size_t MAX_LOG_ENTRIES = 1000;
     
@@ -2,6 +2,7 @@
 #include "../../Core/Log.h"
 #include <sstream>
 #include <iomanip>
+#include <cstring>
 
 namespace UI {
 
@@ -27,6 +28,12 @@ void DebugOverlay::Render() {
             ss << "Delta: " << (deltaTime * 1000.0f) << "ms\n";
         }
         
+        if (bShowFrameTimeStats && frameTimeStats.frameCount > 0) {
+            ss << "Frame p50/p95/p99: " << std::fixed << std::setprecision(2)
+               << frameTimeStats.p50MS << " / " << frameTimeStats.p95MS << " / " << frameTimeStats.p99MS << "ms\n";
+            ss << "Frame max: " << frameTimeStats.maxMS << "ms | Hitches: " << frameTimeStats.hitchCount << "\n";
+        }
+        
         if (bShowStats) {
             ss << "Frames: " << frameCount << "\n";
             ss << "Time: " << std::fixed << std::setprecision(2) << totalTime << "s\n";
@@ -41,6 +48,18 @@ void DebugOverlay::Render() {
             ss << "Render Queue: " << renderQueueSize << " commands\n";
         }
         
+        // Todos los stats registrados (DECLARE_*_STAT), agrupados
+        if (bShowRegisteredStats) {
+            const char* currentGroup = nullptr;
+            for (const FStatValue& stat : FStats::GetFrameSnapshot()) {
+                if (currentGroup == nullptr || std::strcmp(currentGroup, stat.group) != 0) {
+                    currentGroup = stat.group;
+                    ss << "[" << currentGroup << "]\n";
+                }
+                ss << "  " << stat.name << ": " << FStats::FormatValue(stat) << "\n";
+            }
+        }
+        
         UE_LOG_VERBOSE(LogCategories::Core, "%s", ss.str().c_str());
     }
 }
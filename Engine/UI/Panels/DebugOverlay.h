@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../UIBase.h"
+#include "../../Core/FrameStats.h"
+#include "../../Core/Stats.h"
 
 // ============================================================================
 // DebugOverlay - Overlay de debug (FPS, stats, etc.)
@@ -21,6 +23,8 @@ public:
     void SetShowStats(bool show) { bShowStats = show; }
     void SetShowCameraInfo(bool show) { bShowCameraInfo = show; }
     void SetShowRenderQueueInfo(bool show) { bShowRenderQueueInfo = show; }
+    void SetShowFrameTimeStats(bool show) { bShowFrameTimeStats = show; }
+    void SetShowRegisteredStats(bool show) { bShowRegisteredStats = show; }
     
     // Datos a mostrar
     void SetFPS(float fps) { currentFPS = fps; }
@@ -29,6 +33,7 @@ public:
     void SetTotalTime(float time) { totalTime = time; }
     void SetCameraPosition(float x, float y, float z);
     void SetRenderQueueSize(size_t size) { renderQueueSize = size; }
+    void SetFrameTimeStats(const FFrameTimeSummary& summary) { frameTimeStats = summary; }
 
 private:
     // Visibility flags
@@ -36,6 +41,8 @@ private:
     bool bShowStats = true;
     bool bShowCameraInfo = true;
     bool bShowRenderQueueInfo = true;
+    bool bShowFrameTimeStats = true;
+    bool bShowRegisteredStats = true;
     
     // Data
     float currentFPS = 0.0f;
@@ -44,6 +51,7 @@ private:
     float totalTime = 0.0f;
     float cameraX = 0.0f, cameraY = 0.0f, cameraZ = 0.0f;
     size_t renderQueueSize = 0;
+    FFrameTimeSummary frameTimeStats;
     
     // Position
     float overlayX = 10.0f;
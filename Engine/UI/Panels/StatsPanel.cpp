@@ -2,6 +2,7 @@
 #include "../../Core/Log.h"
 #include <sstream>
 #include <iomanip>
+#include <cstring>
 
 namespace UI {
 
@@ -15,13 +16,48 @@ StatsPanel::StatsPanel() {
 void StatsPanel::Render() {
     if (!IsVisible()) return;
     
-    // TODO: Implementar renderizado con eGUI (Rust)
-    // Por ahora es un stub - no renderiza nada
-    // La UI se renderizará desde Rust cuando esté implementada
+    // Igual que DebugOverlay: hasta que el panel se dibuje con eGUI (Rust), el contenido
+    // se emite como texto al log
+    if (++renderCounter % 60 != 0) { // Log cada 60 frames
+        return;
+    }
+    
+    std::stringstream ss;
+    ss << "=== " << GetTitle() << " ===\n";
+    ss << "FPS: " << std::fixed << std::setprecision(2) << currentFPS
+       << " | Delta: " << (deltaTime * 1000.0f) << "ms\n";
+    ss << "Frames: " << frameCount << " | Time: " << totalTime << "s\n";
+    
+    const FFrameTimeSummary* summaries[] = { &windowFrameTimes, &sessionFrameTimes };
+    const char* labels[] = { "Recent", "Session" };
+    for (int i = 0; i < 2; i++) {
+        const FFrameTimeSummary& summary = *summaries[i];
+        if (summary.frameCount == 0) {
+            continue;
+        }
+        ss << labels[i] << " (" << summary.frameCount << " frames) p50/p95/p99: "
+           << summary.p50MS << " / " << summary.p95MS << " / " << summary.p99MS << "ms"
+           << " | max: " << summary.maxMS << "ms"
+           << " | Hitches (>" << hitchBudgetMS << "ms): " << summary.hitchCount << "\n";
+    }
+    
+    // Stats registrados (DECLARE_*_STAT) tomados en Update, agrupados
+    const char* currentGroup = nullptr;
+    for (const FStatValue& stat : stats) {
+        if (currentGroup == nullptr || std::strcmp(currentGroup, stat.group) != 0) {
+            currentGroup = stat.group;
+            ss << "[" << currentGroup << "]\n";
+        }
+        ss << "  " << stat.name << ": " << FStats::FormatValue(stat) << "\n";
+    }
+    
+    UE_LOG_VERBOSE(LogCategories::Core, "%s", ss.str().c_str());
 }
 
 void StatsPanel::Update(float deltaTime) {
-    // Update logic
+    if (!IsVisible()) return;
+    
+    stats = FStats::GetFrameSnapshot();
 }
 
 void StatsPanel::UpdateStats(float fps, float deltaTime, uint64_t frameCount, float totalTime) {
@@ -31,4 +67,10 @@ void StatsPanel::UpdateStats(float fps, float deltaTime, uint64_t frameCount, fl
     this->totalTime = totalTime;
 }
 
+void StatsPanel::UpdateFrameTimeStats(const FFrameTimeSummary& window, const FFrameTimeSummary& session, double hitchBudgetMS) {
+    this->windowFrameTimes = window;
+    this->sessionFrameTimes = session;
+    this->hitchBudgetMS = hitchBudgetMS;
+}
+
 } // namespace UI
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../UIBase.h"
+#include "../../Core/FrameStats.h"
+#include "../../Core/Stats.h"
+#include <vector>
 
 // ============================================================================
 // StatsPanel - Panel de estadísticas del motor
@@ -17,12 +20,27 @@ public:
     virtual void Update(float deltaTime) override;
     
     void UpdateStats(float fps, float deltaTime, uint64_t frameCount, float totalTime);
+    
+    // Percentiles de tiempo de frame: ventana reciente y sesión completa
+    void UpdateFrameTimeStats(const FFrameTimeSummary& window, const FFrameTimeSummary& session, double hitchBudgetMS);
+    
+    // Stats registrados (DECLARE_*_STAT) del último frame agregado, tomados en Update.
+    // Se listan todos por grupo: un stat nuevo no necesita código de UI.
+    const std::vector<FStatValue>& GetStats() const { return stats; }
 
 private:
     float currentFPS = 0.0f;
     float deltaTime = 0.0f;
     uint64_t frameCount = 0;
     float totalTime = 0.0f;
+    
+    FFrameTimeSummary windowFrameTimes;
+    FFrameTimeSummary sessionFrameTimes;
+    double hitchBudgetMS = 0.0;
+    
+    std::vector<FStatValue> stats;
+    
+    uint64_t renderCounter = 0;
 };
 
 } // namespace UI
@@ -1,5 +1,6 @@
 #include "VulkanRenderer.h"
 #include "../Core/Log.h"
+#include "../Core/Stats.h"
 #include "engine_ui_ffi.h"
 #include <fstream>
 #include <stdexcept>
@@ -11,6 +12,13 @@
 
 namespace UI {
 
+// Errores que se repiten cada frame: como mucho uno cada 5 segundos
+static constexpr uint32_t LOG_REPEAT_INTERVAL_MS = 5000;
+
+DECLARE_DWORD_COUNTER_STAT("UI vertices", STAT_UIVertices, UI);
+DECLARE_DWORD_COUNTER_STAT("UI draw calls", STAT_UIDrawCalls, UI);
+DECLARE_MEMORY_COUNTER_STAT("UI bytes uploaded", STAT_UIBytesUploaded, UI);
+
 // Helper function to read file
 static std::vector<char> readFile(const std::string& filename) {
     std::ifstream file(filename, std::ios::ate | std::ios::binary);
@@ -570,11 +578,7 @@ void VulkanRenderer::ensureBufferSize(VkBuffer& buffer, VkDeviceMemory& bufferMe
                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                      buffer, bufferMemory);
         currentSize = newSize;
-        static bool firstBuffer = true;
-        if (firstBuffer) {
-            UE_LOG_INFO(LogCategories::UI, "Created UI buffer: size=%zu bytes, usage=0x%x", newSize, usage);
-            firstBuffer = false;
-        }
+        UE_LOG_ONCE(LogCategories::UI, Log, "Created UI buffer: size=%zu bytes, usage=0x%x", newSize, usage);
     } catch (const std::exception& e) {
         UE_LOG_ERROR(LogCategories::UI, "Failed to create buffer: %s", e.what());
         throw;
@@ -584,11 +588,8 @@ void VulkanRenderer::ensureBufferSize(VkBuffer& buffer, VkDeviceMemory& bufferMe
 void VulkanRenderer::updateBuffers(const void* vertices, size_t vertexCount, 
                                    const void* indices, size_t indexCount) {
     if (vertexCount == 0 || indexCount == 0) {
-        static bool firstWarning = true;
-        if (firstWarning) {
-            UE_LOG_WARNING(LogCategories::UI, "updateBuffers: vertexCount=%zu or indexCount=%zu is 0", vertexCount, indexCount);
-            firstWarning = false;
-        }
+        UE_LOG_THROTTLED(LogCategories::UI, Warning, LOG_REPEAT_INTERVAL_MS,
+                         "updateBuffers: vertexCount=%zu or indexCount=%zu is 0", vertexCount, indexCount);
         return;
     }
     
@@ -626,25 +627,21 @@ void VulkanRenderer::updateBuffers(const void* vertices, size_t vertexCount,
     }
     memcpy(indexData, indices, indexSize);
     vkUnmapMemory(device, indexBufferMemory);
+    
+    INC_DWORD_STAT_BY(STAT_UIVertices, vertexCount);
+    INC_MEMORY_STAT_BY(STAT_UIBytesUploaded, vertexSize + indexSize);
 }
 
 void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex, uint32_t width, uint32_t height) {
     if (!bInitialized) {
-        static bool firstWarning = true;
-        if (firstWarning) {
-            UE_LOG_WARNING(LogCategories::UI, "VulkanRenderer::Render called but not initialized!");
-            firstWarning = false;
-        }
+        UE_LOG_THROTTLED(LogCategories::UI, Warning, LOG_REPEAT_INTERVAL_MS,
+                         "VulkanRenderer::Render called but not initialized!");
         return;
     }
     
     // Verificar que el command buffer es válido
     if (commandBuffer == VK_NULL_HANDLE) {
-        static bool firstError = true;
-        if (firstError) {
-            UE_LOG_ERROR(LogCategories::UI, "Render: commandBuffer is null!");
-            firstError = false;
-        }
+        UE_LOG_THROTTLED(LogCategories::UI, Error, LOG_REPEAT_INTERVAL_MS, "Render: commandBuffer is null!");
         return;
     }
     
@@ -669,7 +666,6 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
     
     // TEST: Crear UI de prueba hardcodeada para verificar que el pipeline funciona
     static bool testMode = false; // ✅ DESACTIVADO - usar datos reales de eGUI
-    static bool testModeLogged = false;
     
     if (testMode) {
         // Crear un rectángulo que cubra TODO EL VIEWPORT para asegurar visibilidad
@@ -692,11 +688,8 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
             0, 2, 3   // Segundo triángulo
         };
         
-        if (!testModeLogged) {
-            UE_LOG_INFO(LogCategories::UI, "🧪 TEST MODE: Rectángulo ROJO en (%.0f,%.0f)-(%.0f,%.0f), screen=%ux%u", 
-                       x1, y1, x2, y2, width, height);
-            testModeLogged = true;
-        }
+        UE_LOG_ONCE(LogCategories::UI, Log, "🧪 TEST MODE: Rectángulo ROJO en (%.0f,%.0f)-(%.0f,%.0f), screen=%ux%u",
+                    x1, y1, x2, y2, width, height);
         
         updateBuffers(testVerts, 4, testIndices, 6);
     } else {
@@ -709,11 +702,8 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
         RenderData renderData{};
         if (!egui_get_render_data(&renderData)) {
             // No hay nada que renderizar
-            static bool firstSkip = true;
-            if (firstSkip) {
-                UE_LOG_WARNING(LogCategories::UI, "VulkanRenderer::Render: No render data available");
-                firstSkip = false;
-            }
+            UE_LOG_THROTTLED(LogCategories::UI, Warning, LOG_REPEAT_INTERVAL_MS,
+                             "VulkanRenderer::Render: No render data available");
             return;
         }
         
@@ -726,8 +716,8 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
         }
         
         // DEBUG: Log de algunos vértices para verificar coordenadas
-        static bool firstVertexLog = true;
-        if (firstVertexLog && renderData.vertices_count > 0) {
+        static FLogOnceState vertexLogState;
+        if (renderData.vertices_count > 0 && vertexLogState.ShouldLog()) {
             const struct UIVertex* verts = static_cast<const struct UIVertex*>(renderData.vertices_ptr);
             UE_LOG_INFO(LogCategories::UI, "=== PRIMEROS VÉRTICES DE eGUI ===");
             for (size_t i = 0; i < std::min(renderData.vertices_count, size_t(10)); i++) {
@@ -739,7 +729,6 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
                 UE_LOG_INFO(LogCategories::UI, "  V[%zu]: pos=(%.1f, %.1f), RGBA=(%.2f, %.2f, %.2f, %.2f)", 
                            i, verts[i].pos[0], verts[i].pos[1], r, g, b, a);
             }
-            firstVertexLog = false;
         }
     }
     
@@ -762,21 +751,15 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
     
     // Verificar que el pipeline existe
     if (graphicsPipeline == VK_NULL_HANDLE) {
-        static bool firstError = true;
-        if (firstError) {
-            UE_LOG_ERROR(LogCategories::UI, "Render: graphicsPipeline is null!");
-            firstError = false;
-        }
+        UE_LOG_THROTTLED(LogCategories::UI, Error, LOG_REPEAT_INTERVAL_MS, "Render: graphicsPipeline is null!");
         return;
     }
     
     // Bind pipeline UI (IMPORTANTE: esto sobrescribe el pipeline del cubo)
     vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
     
-    static bool pipelineBoundLogged = false;
-    if (testMode && !pipelineBoundLogged) {
-        UE_LOG_INFO(LogCategories::UI, "🧪 Pipeline UI bound (esto sobrescribe el pipeline del cubo)");
-        pipelineBoundLogged = true;
+    if (testMode) {
+        UE_LOG_ONCE(LogCategories::UI, Log, "🧪 Pipeline UI bound (esto sobrescribe el pipeline del cubo)");
     }
     
     // Set viewport and scissor (override cube's settings)
@@ -795,11 +778,7 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
     scissor.extent = {width, height};
     vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
     
-    static bool viewportLogged = false;
-    if (!viewportLogged) {
-        UE_LOG_INFO(LogCategories::UI, "🔍 Viewport UI: (%u, %u), Scissor: (%u, %u)", width, height, width, height);
-        viewportLogged = true;
-    }
+    UE_LOG_ONCE(LogCategories::UI, Log, "🔍 Viewport UI: (%u, %u), Scissor: (%u, %u)", width, height, width, height);
     
     // Push constants: Screen space to clip space transformation
     // eGUI screen space: (0,0) = top-left, Y increases downward, X increases rightward
@@ -824,8 +803,8 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
     float pushConstants[4] = {scaleX, scaleY, translateX, translateY};
     
     // Debug: Log transformation parameters (only once)
-    static bool transformLogged = false;
-    if (!transformLogged) {
+    static FLogOnceState transformLogState;
+    if (transformLogState.ShouldLog()) {
         UE_LOG_INFO(LogCategories::UI, "UI Transform: scale=(%.6f, %.6f), translate=(%.6f, %.6f), viewport=(%u, %u)",
                    scaleX, scaleY, translateX, translateY, width, height);
         
@@ -840,8 +819,6 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
         clipX = testX * scaleX + translateX;
         clipY = testY * scaleY + translateY;
         UE_LOG_INFO(LogCategories::UI, "  Corner (%u,%u) -> clip (%.3f, %.3f) [expected: (1, -1)]", width, height, clipX, clipY);
-        
-        transformLogged = true;
     }
     
     vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 
@@ -850,11 +827,7 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
     // Bind descriptor set (requerido por el pipeline layout)
     // El fragment shader usará la textura, pero para colores rojos la ignorará
     if (fontDescriptorSet == VK_NULL_HANDLE) {
-        static bool firstError = true;
-        if (firstError) {
-            UE_LOG_ERROR(LogCategories::UI, "Render: fontDescriptorSet is null!");
-            firstError = false;
-        }
+        UE_LOG_THROTTLED(LogCategories::UI, Error, LOG_REPEAT_INTERVAL_MS, "Render: fontDescriptorSet is null!");
         return;
     }
     vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
@@ -862,12 +835,9 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
     
     // Verificar que los buffers existen antes de bindearlos
     if (vertexBuffer == VK_NULL_HANDLE || indexBuffer == VK_NULL_HANDLE) {
-        static bool firstError = true;
-        if (firstError) {
-            UE_LOG_ERROR(LogCategories::UI, "Render: Buffers are null! vertexBuffer=%p, indexBuffer=%p", 
+        UE_LOG_THROTTLED(LogCategories::UI, Error, LOG_REPEAT_INTERVAL_MS,
+                         "Render: Buffers are null! vertexBuffer=%p, indexBuffer=%p",
                          (void*)vertexBuffer, (void*)indexBuffer);
-            firstError = false;
-        }
         return;
     }
     
@@ -881,9 +851,10 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
     
     // Draw
     vkCmdDrawIndexed(commandBuffer, indexCount, 1, 0, 0, 0);
+    INC_DWORD_STAT(STAT_UIDrawCalls);
     
-    static bool firstDraw = true;
-    if (firstDraw) {
+    static FLogOnceState firstDrawLogState;
+    if (firstDrawLogState.ShouldLog()) {
         if (testMode) {
             UE_LOG_INFO(LogCategories::UI, "🧪 TEST MODE: Dibujando 6 índices (rectángulo rojo)");
             UE_LOG_INFO(LogCategories::UI, "   Si ves un rectángulo rojo, el pipeline funciona!");
@@ -891,7 +862,6 @@ void VulkanRenderer::Render(VkCommandBuffer commandBuffer, uint32_t imageIndex,
             UE_LOG_INFO(LogCategories::UI, "✅ DRAW CALL: %u indices (~%u triangles)", indexCount, indexCount / 3);
         }
         UE_LOG_INFO(LogCategories::UI, "   Viewport: %ux%u | Pipeline bound", width, height);
-        firstDraw = false;
     }
 }
 
@@ -970,6 +940,7 @@ void VulkanRenderer::updateFontTexture(const void* pixels, uint32_t width, uint3
     vkMapMemory(device, stagingBufferMemory, 0, imageSize, 0, &data);
     memcpy(data, pixels, imageSize);
     vkUnmapMemory(device, stagingBufferMemory);
+    INC_MEMORY_STAT_BY(STAT_UIBytesUploaded, imageSize);
     
     // Command buffer para upload
     VkCommandBufferAllocateInfo allocInfo{};
@@ -0,0 +1,1156 @@
+#include "Core/Log.h"
+#include "Core/Math/MathBatch.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Quaternion.h"
+#include "Core/Math/Transform.h"
+#include "Core/Math/VectorRegister.h"
+#include "Core/Object/UObject.h"
+#include "Core/Object/UClass.h"
+#include "Core/Profiler.h"
+#include "Core/Threading/RenderCommandQueue.h"
+#include "UI/Panels/ConsolePanel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Microbenchmarks de los subsistemas del engine (math, RenderCommandQueue, FLog, UObject).
+//
+// Cada benchmark ejecuta un número fijo de operaciones por repetición. Primero se
+// descartan unas repeticiones de calentamiento (caches, branch predictor, páginas del
+// ring de logs) y después se mide cada repetición por separado; se informa el mínimo
+// (el ruido solo suma tiempo) y la mediana en ns por operación, y el throughput (Mops/s)
+// de la mediana.
+//
+//   EngineBenchmarks [-Filter=Matrix] [-Repetitions=N] [-Warmup=N] [-Json=results.json]
+//
+// Antes de medir se comprueban los kernels SIMD de Matrix4x4, Quaternion y MathBatch
+// contra su versión escalar, RenderCommandQueue con lambdas cuya copia lanza y los
+// comandos de consola (log, profile); si algo falla el programa termina con código 1
+// sin medir nada.
+
+namespace {
+
+constexpr int DEFAULT_WARMUP_REPETITIONS = 2;
+constexpr int DEFAULT_REPETITIONS = 9;
+
+// Impide que el compilador elimine un cálculo cuyo resultado no se usa
+template<typename ValueType>
+inline void DoNotOptimize(const ValueType& value) {
+#if defined(_MSC_VER)
+    static volatile const void* sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+struct FBenchmarkResult {
+    std::string name;
+    uint64_t operations;    // Por repetición
+    double minNS;           // ns por operación
+    double medianNS;
+    double maxNS;
+};
+
+class FBenchmarkRunner {
+public:
+    FBenchmarkRunner(int warmupRepetitions, int repetitions, const std::string& filter)
+        : warmupRepetitions(warmupRepetitions)
+        , repetitions(std::max(repetitions, 1))
+        , filter(filter)
+    {
+    }
+
+    // body(operations) ejecuta 'operations' veces la operación medida
+    template<typename BodyType>
+    void Run(const char* name, uint64_t operations, BodyType&& body) {
+        Run(name, operations, [] {}, body, [] {});
+    }
+
+    // setup() y teardown() se ejecutan en cada repetición fuera de la medición
+    // (p. ej. llenar o vaciar una cola que body consume o llena)
+    template<typename SetupType, typename BodyType, typename TeardownType>
+    void Run(const char* name, uint64_t operations, SetupType&& setup, BodyType&& body, TeardownType&& teardown) {
+        RunSelfTimed(name, operations, [&](uint64_t operationCount) {
+            setup();
+            auto startTime = std::chrono::steady_clock::now();
+            body(operationCount);
+            auto endTime = std::chrono::steady_clock::now();
+            teardown();
+            return std::chrono::duration<double, std::nano>(endTime - startTime).count();
+        });
+    }
+
+    // body(operations) mide él mismo y devuelve los ns medidos: para intercalar trabajo
+    // fuera de la medición dentro de una repetición (p. ej. vaciar una cola cada N operaciones)
+    template<typename BodyType>
+    void RunSelfTimed(const char* name, uint64_t operations, BodyType&& body) {
+        if (!filter.empty() && std::strstr(name, filter.c_str()) == nullptr) {
+            return;
+        }
+
+        for (int r = 0; r < warmupRepetitions; r++) {
+            body(operations);
+        }
+
+        std::vector<double> samples;
+        samples.reserve(repetitions);
+        for (int r = 0; r < repetitions; r++) {
+            double nanoseconds = body(operations);
+            samples.push_back(nanoseconds / static_cast<double>(operations));
+        }
+        std::sort(samples.begin(), samples.end());
+
+        FBenchmarkResult result;
+        result.name = name;
+        result.operations = operations;
+        result.minNS = samples.front();
+        result.medianNS = samples.size() % 2 == 1
+            ? samples[samples.size() / 2]
+            : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) * 0.5;
+        result.maxNS = samples.back();
+        results.push_back(result);
+
+        std::printf("%-36s %12llu %12.2f %12.2f %12.2f\n", result.name.c_str(),
+                    static_cast<unsigned long long>(result.operations), result.minNS, result.medianNS,
+                    1000.0 / result.medianNS);
+    }
+
+    bool WriteJson(const std::string& filePath) const {
+        std::string json = "{\"benchmark\":\"EngineBenchmarks\",";
+        char buffer[256];
+        std::snprintf(buffer, sizeof(buffer),
+                      "\"mathBackend\":\"%s\",\"warmupRepetitions\":%d,\"repetitions\":%d,\n\"results\":[",
+                      MatrixKernels::GetBackendName(), warmupRepetitions, repetitions);
+        json += buffer;
+        for (size_t i = 0; i < results.size(); i++) {
+            const FBenchmarkResult& result = results[i];
+            std::snprintf(buffer, sizeof(buffer),
+                          "%s\n{\"name\":\"%s\",\"operations\":%llu,\"minNS\":%.3f,\"medianNS\":%.3f,\"maxNS\":%.3f}",
+                          i == 0 ? "" : ",", result.name.c_str(),
+                          static_cast<unsigned long long>(result.operations), result.minNS, result.medianNS,
+                          result.maxNS);
+            json += buffer;
+        }
+        json += "\n]}\n";
+
+        std::ofstream file(filePath, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file.is_open()) {
+            std::fprintf(stderr, "Could not write benchmark results to %s\n", filePath.c_str());
+            return false;
+        }
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        return true;
+    }
+
+private:
+    int warmupRepetitions;
+    int repetitions;
+    std::string filter;
+    std::vector<FBenchmarkResult> results;
+};
+
+// Jerarquía de 4 niveles para IsChildOf (el peor caso recorre toda la cadena)
+const UClass& GetBenchmarkBaseClass() {
+    static const UClass classInfo("BenchmarkBase");
+    return classInfo;
+}
+
+const UClass& GetBenchmarkActorClass() {
+    static const UClass classInfo("BenchmarkActor", &GetBenchmarkBaseClass());
+    return classInfo;
+}
+
+const UClass& GetBenchmarkPawnClass() {
+    static const UClass classInfo("BenchmarkPawn", &GetBenchmarkActorClass());
+    return classInfo;
+}
+
+const UClass& GetBenchmarkCharacterClass() {
+    static const UClass classInfo("BenchmarkCharacter", &GetBenchmarkPawnClass());
+    return classInfo;
+}
+
+const UClass& GetBenchmarkUnrelatedClass() {
+    static const UClass classInfo("BenchmarkUnrelated");
+    return classInfo;
+}
+
+// UObject mínimo: mide el coste de UObject en sí (ID, nombre, flags, stat)
+class UBenchmarkObject : public UObject {
+public:
+    virtual const UClass* GetClass() const override { return &GetBenchmarkCharacterClass(); }
+    virtual const char* GetClassTypeName() const override { return "BenchmarkCharacter"; }
+};
+
+// Payload típico de un comando UpdateUniforms (una matriz 4x4), como en RenderQueueBenchmark
+struct FUniformPayload {
+    float matrix[16];
+};
+
+// Puntos/matrices por llamada a MathBatch (un buffer de vértices o de hijos típico)
+constexpr size_t BATCH_SIZE = 4096;
+
+// Menos que RENDER_COMMAND_RING_CAPACITY: un solo thread encola y ejecuta
+constexpr uint64_t RENDER_COMMANDS_PER_BATCH = 1024;
+
+// Matriz aleatoria bien condicionada: diagonal dominante, |det| lejos de 0
+Matrix4x4 MakeRandomMatrix(std::mt19937& random) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    Matrix4x4 matrix;
+    for (int i = 0; i < 16; i++) {
+        matrix.m[i] = distribution(random);
+    }
+    for (int i = 0; i < 4; i++) {
+        matrix(i, i) += distribution(random) < 0.0f ? -4.0f : 4.0f;
+    }
+    return matrix;
+}
+
+// Error relativo máximo entre dos arrays (relativo a 1 para valores pequeños)
+float MaxRelativeError(const float* values, const float* expected, int count) {
+    float maxError = 0.0f;
+    for (int i = 0; i < count; i++) {
+        float error = std::abs(values[i] - expected[i]) / std::max(std::abs(expected[i]), 1.0f);
+        maxError = std::max(maxError, error);
+    }
+    return maxError;
+}
+
+// Kernels SIMD contra la referencia escalar. Multiply y TransformVector4 suman en el
+// mismo orden: deben coincidir bit a bit. Determinant y las inversas redondean de
+// otra forma: tolerancia relativa.
+bool VerifyMathKernels() {
+    constexpr int MATRIX_COUNT = 10000;
+    constexpr float TOLERANCE = 1e-4f;
+
+    std::mt19937 random(20240601);
+    std::uniform_real_distribution<float> positions(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> angles(-180.0f, 180.0f);
+    std::uniform_real_distribution<float> scales(0.25f, 4.0f);
+    int bitMismatches = 0;
+    float maxDeterminantError = 0.0f;
+    float maxInverseError = 0.0f;
+    float maxAffineError = 0.0f;
+    for (int i = 0; i < MATRIX_COUNT; i++) {
+        const Matrix4x4 a = MakeRandomMatrix(random);
+        const Matrix4x4 b = MakeRandomMatrix(random);
+        float simd[16];
+        float scalar[16];
+
+        MatrixKernels::Multiply(a.m, b.m, simd);
+        MatrixKernels::MultiplyScalar(a.m, b.m, scalar);
+        bitMismatches += std::memcmp(simd, scalar, sizeof(simd)) != 0 ? 1 : 0;
+
+        MatrixKernels::TransformVector4(a.m, b.m, simd);
+        MatrixKernels::TransformVector4Scalar(a.m, b.m, scalar);
+        bitMismatches += std::memcmp(simd, scalar, 4 * sizeof(float)) != 0 ? 1 : 0;
+
+        float determinant = MatrixKernels::Determinant(a.m);
+        float scalarDeterminant = MatrixKernels::DeterminantScalar(a.m);
+        maxDeterminantError = std::max(maxDeterminantError,
+                                       MaxRelativeError(&determinant, &scalarDeterminant, 1));
+
+        if (MatrixKernels::Inverse(a.m, simd) && MatrixKernels::InverseScalar(a.m, scalar)) {
+            maxInverseError = std::max(maxInverseError, MaxRelativeError(simd, scalar, 16));
+        } else {
+            bitMismatches++;
+        }
+
+        const Matrix4x4 affine = Matrix4x4::TRS(Vector3(positions(random), positions(random), positions(random)),
+                                                Quaternion::FromEuler(Vector3(angles(random), angles(random),
+                                                                              angles(random))),
+                                                Vector3(scales(random), scales(random), scales(random)));
+        if (MatrixKernels::InverseAffine(affine.m, simd) && MatrixKernels::InverseScalar(affine.m, scalar)) {
+            maxAffineError = std::max(maxAffineError, MaxRelativeError(simd, scalar, 16));
+        } else {
+            bitMismatches++;
+        }
+    }
+
+    bool bPassed = bitMismatches == 0 && maxDeterminantError < TOLERANCE && maxInverseError < TOLERANCE &&
+                   maxAffineError < TOLERANCE;
+    std::printf("Math kernels (%s) vs scalar, %d matrices: %s (bit mismatches %d, max relative error: "
+                "determinant %.2g, inverse %.2g, affine inverse %.2g)\n\n",
+                MatrixKernels::GetBackendName(), MATRIX_COUNT, bPassed ? "OK" : "FAILED", bitMismatches,
+                maxDeterminantError, maxInverseError, maxAffineError);
+    return bPassed;
+}
+
+// MathBatch contra las operaciones de un elemento: cada lane hace las mismas sumas en
+// el mismo orden, así que debe coincidir bit a bit. Tamaño impar para cubrir la cola escalar.
+bool VerifyBatchTransforms() {
+    constexpr size_t POINT_COUNT = 1003;
+
+    std::mt19937 random(20240602);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    const Matrix4x4 matrix = Matrix4x4::TRS(Vector3(3.0f, -7.0f, 12.5f),
+                                            Quaternion::FromEuler(Vector3(30.0f, -45.0f, 110.0f)),
+                                            Vector3(0.5f, 2.0f, 1.5f));
+
+    std::vector<Vector3> points(POINT_COUNT);
+    for (Vector3& point : points) {
+        point = Vector3(distribution(random), distribution(random), distribution(random));
+    }
+    std::vector<float> xs(POINT_COUNT), ys(POINT_COUNT), zs(POINT_COUNT);
+    std::vector<float> outXs(POINT_COUNT), outYs(POINT_COUNT), outZs(POINT_COUNT);
+    MathBatch::AoSToSoA(points.data(), xs.data(), ys.data(), zs.data(), POINT_COUNT);
+
+    int mismatches = 0;
+    std::vector<Vector3> roundTrip(POINT_COUNT);
+    MathBatch::SoAToAoS(xs.data(), ys.data(), zs.data(), roundTrip.data(), POINT_COUNT);
+    mismatches += std::memcmp(roundTrip.data(), points.data(), POINT_COUNT * sizeof(Vector3)) != 0 ? 1 : 0;
+
+    MathBatch::TransformPoints(matrix, xs.data(), ys.data(), zs.data(), outXs.data(), outYs.data(), outZs.data(),
+                               POINT_COUNT);
+    for (size_t i = 0; i < POINT_COUNT; i++) {
+        Vector3 expected = matrix.TransformPoint(points[i]);
+        Vector3 result(outXs[i], outYs[i], outZs[i]);
+        mismatches += std::memcmp(&expected, &result, sizeof(Vector3)) != 0 ? 1 : 0;
+    }
+
+    // En el sitio: la salida es la entrada
+    MathBatch::TransformVectors(matrix, xs.data(), ys.data(), zs.data(), xs.data(), ys.data(), zs.data(),
+                                POINT_COUNT);
+    for (size_t i = 0; i < POINT_COUNT; i++) {
+        Vector3 expected = matrix.TransformVector(points[i]);
+        Vector3 result(xs[i], ys[i], zs[i]);
+        mismatches += std::memcmp(&expected, &result, sizeof(Vector3)) != 0 ? 1 : 0;
+    }
+
+    constexpr size_t MATRIX_COUNT = 67;
+    std::vector<Matrix4x4> left(MATRIX_COUNT), right(MATRIX_COUNT), products(MATRIX_COUNT);
+    for (size_t i = 0; i < MATRIX_COUNT; i++) {
+        left[i] = MakeRandomMatrix(random);
+        right[i] = MakeRandomMatrix(random);
+    }
+    MathBatch::MultiplyMatrices(left.data(), right.data(), products.data(), MATRIX_COUNT);
+    for (size_t i = 0; i < MATRIX_COUNT; i++) {
+        Matrix4x4 expected = left[i] * right[i];
+        mismatches += std::memcmp(expected.m, products[i].m, sizeof(expected.m)) != 0 ? 1 : 0;
+    }
+    MathBatch::MultiplyMatrices(matrix, right.data(), products.data(), MATRIX_COUNT);
+    for (size_t i = 0; i < MATRIX_COUNT; i++) {
+        Matrix4x4 expected = matrix * right[i];
+        mismatches += std::memcmp(expected.m, products[i].m, sizeof(expected.m)) != 0 ? 1 : 0;
+    }
+
+    std::printf("MathBatch vs per-element, %zu points / %zu matrices: %s (mismatches %d)\n\n", POINT_COUNT,
+                MATRIX_COUNT, mismatches == 0 ? "OK" : "FAILED", mismatches);
+    return mismatches == 0;
+}
+
+// Quaternion sobre VectorRegister contra las fórmulas escalares. El producto suma en
+// el mismo orden (bit a bit); RotateVector, ToMatrix y las normalizaciones redondean
+// de otra forma: tolerancia relativa.
+//
+// Con FMA en el target (ENGINE_MATH_AVX2) GCC vectoriza la fórmula escalar del producto
+// en vfmaddsub aunque se compile con -ffp-contract=off, así que ahí la referencia ya no
+// redondea cada producto y el producto también se compara con tolerancia.
+#if defined(__FMA__) || defined(__AVX2__)
+constexpr bool EXACT_QUATERNION_PRODUCT = false;
+#else
+constexpr bool EXACT_QUATERNION_PRODUCT = true;
+#endif
+
+bool VerifyQuaternionKernels() {
+    constexpr int QUATERNION_COUNT = 10000;
+    constexpr float TOLERANCE = 1e-4f;
+
+    std::mt19937 random(20240603);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    int bitMismatches = 0;
+    float maxProductError = 0.0f;
+    float maxRotateError = 0.0f;
+    float maxMatrixError = 0.0f;
+    float maxNormalizeError = 0.0f;
+    for (int i = 0; i < QUATERNION_COUNT; i++) {
+        const Quaternion a = Quaternion(distribution(random), distribution(random), distribution(random),
+                                        distribution(random)).Normalized();
+        const Quaternion b = Quaternion(distribution(random), distribution(random), distribution(random),
+                                        distribution(random)).Normalized();
+        const Vector3 vector(distribution(random) * 10.0f, distribution(random) * 10.0f,
+                             distribution(random) * 10.0f);
+
+        const Quaternion product = a * b;
+        const Quaternion expectedProduct(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                                         a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                                         a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                                         a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+        if (EXACT_QUATERNION_PRODUCT) {
+            bitMismatches += std::memcmp(&product, &expectedProduct, sizeof(Quaternion)) != 0 ? 1 : 0;
+        } else {
+            maxProductError = std::max(maxProductError, MaxRelativeError(&product.x, &expectedProduct.x, 4));
+        }
+
+        // q * (v, 0) * q^-1
+        const Quaternion rotated = a * Quaternion(vector.x, vector.y, vector.z, 0.0f) * a.Conjugate();
+        const Vector3 result = a.RotateVector(vector);
+        maxRotateError = std::max(maxRotateError, MaxRelativeError(&result.x, &rotated.x, 3));
+
+        // Componer rotaciones o matrices debe dar lo mismo
+        const Matrix4x4 matrix = product.ToMatrix();
+        const Matrix4x4 expectedMatrix = a.ToMatrix() * b.ToMatrix();
+        maxMatrixError = std::max(maxMatrixError, MaxRelativeError(matrix.m, expectedMatrix.m, 16));
+
+        float fast[4];
+        float exact[4];
+        const VectorRegister value = VectorLoad(vector);
+        VectorStore(VectorNormalize3Fast(value), fast);
+        VectorStore(VectorNormalize3(value), exact);
+        maxNormalizeError = std::max(maxNormalizeError, MaxRelativeError(fast, exact, 3));
+    }
+
+    // Min/Max/Select por lane
+    float lanes[4];
+    const VectorRegister left = VectorSet(1.0f, -2.0f, 3.0f, -4.0f);
+    const VectorRegister right = VectorSet(-1.0f, 2.0f, -3.0f, 4.0f);
+    VectorStore(VectorSelect(VectorCompareGT(left, right), VectorMin(left, right), VectorMax(left, right)), lanes);
+    bitMismatches += (lanes[0] != -1.0f || lanes[1] != 2.0f || lanes[2] != -3.0f || lanes[3] != 4.0f) ? 1 : 0;
+
+    bool bPassed = bitMismatches == 0 && maxRotateError < TOLERANCE && maxMatrixError < TOLERANCE &&
+                   maxNormalizeError < TOLERANCE && maxProductError < TOLERANCE;
+    std::printf("Quaternion/VectorRegister (%s), %d quaternions: %s (bit mismatches %d, max relative error: "
+                "product %.2g, rotate %.2g, to matrix %.2g, fast normalize %.2g)\n\n",
+                MATH_SIMD_BACKEND_NAME, QUATERNION_COUNT, bPassed ? "OK" : "FAILED", bitMismatches,
+                maxProductError, maxRotateError, maxMatrixError, maxNormalizeError);
+    return bPassed;
+}
+
+// Cuaternión unitario aleatorio
+Quaternion MakeRandomRotation(std::mt19937& random) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    return Quaternion(distribution(random), distribution(random), distribution(random),
+                      distribution(random)).Normalized();
+}
+
+// Kernels de cuaterniones de MathBatch. Normalize, Nlerp, RotateVectors y ToMatrix
+// hacen las mismas operaciones que Quaternion (bit a bit); Slerp usa un polinomio y se
+// compara contra acos/sin en double.
+bool VerifyQuaternionBatches() {
+    constexpr size_t QUATERNION_COUNT = 1003;
+    constexpr double SLERP_TOLERANCE = 1e-6;
+
+    std::mt19937 random(20240604);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> interpolation(0.0f, 1.0f);
+    std::vector<Quaternion> a(QUATERNION_COUNT), b(QUATERNION_COUNT), unnormalized(QUATERNION_COUNT);
+    std::vector<float> ts(QUATERNION_COUNT), xs(QUATERNION_COUNT), ys(QUATERNION_COUNT), zs(QUATERNION_COUNT);
+    for (size_t i = 0; i < QUATERNION_COUNT; i++) {
+        a[i] = MakeRandomRotation(random);
+        b[i] = MakeRandomRotation(random);
+        unnormalized[i] = Quaternion(distribution(random), distribution(random), distribution(random),
+                                     distribution(random));
+        ts[i] = interpolation(random);
+        xs[i] = distribution(random);
+        ys[i] = distribution(random);
+        zs[i] = distribution(random);
+    }
+    // Extremos: mismo cuaternión, opuestos (mismo giro) y longitud cero
+    b[0] = a[0];
+    b[1] = -a[1];
+    unnormalized[2] = Quaternion(0.0f, 0.0f, 0.0f, 0.0f);
+
+    int mismatches = 0;
+    std::vector<Quaternion> results(QUATERNION_COUNT);
+    MathBatch::NormalizeQuaternions(unnormalized.data(), results.data(), QUATERNION_COUNT);
+    for (size_t i = 0; i < QUATERNION_COUNT; i++) {
+        Quaternion expected = unnormalized[i].Normalized();
+        mismatches += std::memcmp(&expected, &results[i], sizeof(Quaternion)) != 0 ? 1 : 0;
+    }
+
+    MathBatch::NlerpQuaternions(a.data(), b.data(), ts.data(), results.data(), QUATERNION_COUNT);
+    for (size_t i = 0; i < QUATERNION_COUNT; i++) {
+        Quaternion target = a[i].Dot(b[i]) < 0.0f ? -b[i] : b[i];
+        Quaternion expected = (a[i] + (target - a[i]) * ts[i]).Normalized();
+        mismatches += std::memcmp(&expected, &results[i], sizeof(Quaternion)) != 0 ? 1 : 0;
+    }
+
+    double maxSlerpError = 0.0;
+    MathBatch::SlerpQuaternions(a.data(), b.data(), ts.data(), results.data(), QUATERNION_COUNT);
+    for (size_t i = 0; i < QUATERNION_COUNT; i++) {
+        double dot = a[i].Dot(b[i]);
+        double sign = dot < 0.0 ? -1.0 : 1.0;
+        double theta = std::acos(std::min(std::abs(dot), 1.0));
+        double weightA = 1.0 - ts[i];
+        double weightB = ts[i];
+        if (theta > 1e-6) {
+            weightA = std::sin((1.0 - ts[i]) * theta) / std::sin(theta);
+            weightB = std::sin(ts[i] * theta) / std::sin(theta);
+        }
+        for (int component = 0; component < 4; component++) {
+            double expected = a[i][component] * weightA + b[i][component] * sign * weightB;
+            maxSlerpError = std::max(maxSlerpError, std::abs(results[i][component] - expected));
+        }
+    }
+
+    std::vector<float> outXs(QUATERNION_COUNT), outYs(QUATERNION_COUNT), outZs(QUATERNION_COUNT);
+    MathBatch::RotateVectors(a.data(), xs.data(), ys.data(), zs.data(), outXs.data(), outYs.data(), outZs.data(),
+                             QUATERNION_COUNT);
+    for (size_t i = 0; i < QUATERNION_COUNT; i++) {
+        Vector3 expected = a[i].RotateVector(Vector3(xs[i], ys[i], zs[i]));
+        Vector3 result(outXs[i], outYs[i], outZs[i]);
+        mismatches += std::memcmp(&expected, &result, sizeof(Vector3)) != 0 ? 1 : 0;
+    }
+
+    // Una sola rotación: a través de su matriz
+    MathBatch::RotateVectors(a[3], xs.data(), ys.data(), zs.data(), outXs.data(), outYs.data(), outZs.data(),
+                             QUATERNION_COUNT);
+    const Matrix4x4 rotation = a[3].ToMatrix();
+    for (size_t i = 0; i < QUATERNION_COUNT; i++) {
+        Vector3 expected = rotation.TransformVector(Vector3(xs[i], ys[i], zs[i]));
+        Vector3 result(outXs[i], outYs[i], outZs[i]);
+        mismatches += std::memcmp(&expected, &result, sizeof(Vector3)) != 0 ? 1 : 0;
+    }
+
+    std::vector<Matrix4x4> matrices(QUATERNION_COUNT);
+    MathBatch::QuaternionsToMatrices(a.data(), matrices.data(), QUATERNION_COUNT);
+    for (size_t i = 0; i < QUATERNION_COUNT; i++) {
+        Matrix4x4 expected = a[i].ToMatrix();
+        // != y no memcmp: +0 y -0 son el mismo elemento
+        for (int element = 0; element < 16; element++) {
+            mismatches += expected.m[element] != matrices[i].m[element] ? 1 : 0;
+        }
+    }
+
+    bool bPassed = mismatches == 0 && maxSlerpError < SLERP_TOLERANCE;
+    std::printf("MathBatch quaternions vs Quaternion, %zu quaternions: %s (mismatches %d, slerp max error %.2g)\n",
+                QUATERNION_COUNT, bPassed ? "OK" : "FAILED", mismatches, maxSlerpError);
+    return bPassed;
+}
+
+// Functor cuya copia lanza: Enqueue de un lvalue tiene que copiarlo
+struct FThrowingCopyCommand {
+    int* executed;
+
+    explicit FThrowingCopyCommand(int* executedCount) : executed(executedCount) {}
+    FThrowingCopyCommand(const FThrowingCopyCommand&) { throw std::runtime_error("copy failed"); }
+    FThrowingCopyCommand(FThrowingCopyCommand&&) noexcept = default;
+
+    void operator()() const { (*executed)++; }
+};
+
+// Una excepción al copiar el lambda sale de Enqueue sin dejar una celda del ring
+// reclamada y sin publicar: los comandos posteriores se siguen ejecutando
+bool VerifyRenderCommandQueue() {
+    RenderCommandQueue& queue = RenderCommandQueue::Get();
+    int failures = 0;
+    auto expect = [&failures](bool bCondition, const char* description) {
+        if (!bCondition) {
+            std::printf("  render command queue check failed: %s\n", description);
+            failures++;
+        }
+    };
+    auto enqueueThrowing = [&queue](const FThrowingCopyCommand& command) {
+        try {
+            queue.Enqueue(ERenderCommandType::Custom, command);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+
+    int throwingExecuted = 0;
+    int executed = 0;
+    const FThrowingCopyCommand throwingCommand(&throwingExecuted);
+
+    expect(enqueueThrowing(throwingCommand), "Enqueue propagates the copy exception");
+    queue.Enqueue(ERenderCommandType::Custom, [&executed]() { executed++; });
+    queue.ExecuteAll();
+    expect(executed == 1 && queue.IsEmpty(), "commands after the exception run");
+
+    {
+        FScopedRenderCommandBuffer commandBuffer;
+        expect(enqueueThrowing(throwingCommand), "buffered Enqueue propagates the copy exception");
+        queue.Enqueue(ERenderCommandType::Custom, [&executed]() { executed++; });
+    }
+    queue.ExecuteAll();
+    expect(executed == 2 && queue.IsEmpty(), "buffered commands after the exception run");
+
+    // Un functor movido sí se construye en la celda
+    queue.Enqueue(ERenderCommandType::Custom, FThrowingCopyCommand(&throwingExecuted));
+    queue.ExecuteAll();
+    expect(throwingExecuted == 1, "moved functor runs once");
+
+    std::printf("RenderCommandQueue with throwing lambda copies: %s (%d failed checks)\n",
+                failures == 0 ? "OK" : "FAILED", failures);
+    return failures == 0;
+}
+
+// Comandos de la consola ("log ..." y "profile ...") por el mismo camino que la entrada
+// de la terminal: QueueCommand/SubmitInput y Update
+bool VerifyConsoleCommands() {
+    static const char TRACE_FILE[] = "EngineBenchmarks.trace.json";
+    UI::ConsolePanel console;
+    int failures = 0;
+    auto expect = [&failures](bool bCondition, const char* description) {
+        if (!bCondition) {
+            std::printf("  console check failed: %s\n", description);
+            failures++;
+        }
+    };
+    auto lastEntryLevel = [&console]() { return console.GetLogs().back().level; };
+
+    // Verbosidad por categoría
+    const ELogVerbosity renderVerbosity = LogCategories::Render::Instance.GetVerbosity();
+    console.QueueCommand("log LogRender VeryVerbose");
+    console.Update(0.0f);
+    expect(LogCategories::Render::Instance.GetVerbosity() == ELogVerbosity::VeryVerbose, "log LogRender VeryVerbose");
+    console.QueueCommand("log render off");
+    console.Update(0.0f);
+    expect(!LogCategories::Render::Instance.IsActive(ELogVerbosity::Error), "log render off");
+    console.ExecuteCommand("log LogRender Loudly");
+    expect(lastEntryLevel() == UI::ELogLevel::Error, "invalid verbosity is reported");
+    console.ExecuteCommand("log reset");
+    expect(LogCategories::Render::Instance.GetVerbosity() == renderVerbosity, "log reset");
+
+    // Captura del profiler: empieza con el comando y termina sola tras N frames
+    std::remove(TRACE_FILE);
+    console.SetInputText(std::string("profile 2 ") + TRACE_FILE);
+    console.SubmitInput();
+    expect(FProfiler::IsCapturing(), "profile 2 starts a capture");
+    {
+        PROFILE_SCOPE("ConsoleCheck");
+    }
+    FProfiler::EndFrame();
+    FProfiler::EndFrame();
+    expect(!FProfiler::IsCapturing(), "capture stops after 2 frames");
+    std::ifstream trace(TRACE_FILE);
+    std::string traceText((std::istreambuf_iterator<char>(trace)), std::istreambuf_iterator<char>());
+    expect(traceText.find("\"ConsoleCheck\"") != std::string::npos, "trace contains the scope");
+    trace.close();
+    std::remove(TRACE_FILE);
+
+    // profile stop: sin captura avisa; con captura la detiene y escribe el trace
+    console.ExecuteCommand("profile stop");
+    expect(lastEntryLevel() == UI::ELogLevel::Warning, "profile stop without a capture warns");
+    console.ExecuteCommand(std::string("profile 1000 ") + TRACE_FILE);
+    console.ExecuteCommand("profile stop");
+    expect(!FProfiler::IsCapturing(), "profile stop ends the capture");
+    expect(std::ifstream(TRACE_FILE).good(), "profile stop writes the trace");
+    std::remove(TRACE_FILE);
+
+    std::printf("Console commands (log, profile): %s (%d failed checks)\n\n", failures == 0 ? "OK" : "FAILED",
+                failures);
+    return failures == 0;
+}
+
+void RunMathBenchmarks(FBenchmarkRunner& runner) {
+    const Matrix4x4 model = Matrix4x4::TRS(Vector3(1.0f, 2.0f, 3.0f),
+                                           Quaternion::FromEuler(Vector3(30.0f, 45.0f, 60.0f)),
+                                           Vector3(1.0f, 2.0f, 0.5f));
+    const Matrix4x4 viewProjection = Matrix4x4::Perspective(60.0f, 16.0f / 9.0f, 0.1f, 100.0f) *
+        Matrix4x4::LookAt(Vector3(0.0f, 2.0f, -5.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+
+    runner.Run("Matrix4x4/Multiply", 1000000, [&](uint64_t operations) {
+        Matrix4x4 left = viewProjection;
+        Matrix4x4 right = model;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(left);
+            DoNotOptimize(right);
+            Matrix4x4 result = left * right;
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Matrix4x4/MultiplyScalar", 1000000, [&](uint64_t operations) {
+        Matrix4x4 left = viewProjection;
+        Matrix4x4 right = model;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(left);
+            DoNotOptimize(right);
+            Matrix4x4 result;
+            MatrixKernels::MultiplyScalar(left.m, right.m, result.m);
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Matrix4x4/Inversed", 1000000, [&](uint64_t operations) {
+        Matrix4x4 matrix = model;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(matrix);
+            Matrix4x4 result = matrix.Inversed();
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Matrix4x4/InverseScalar", 1000000, [&](uint64_t operations) {
+        Matrix4x4 matrix = model;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(matrix);
+            Matrix4x4 result;
+            MatrixKernels::InverseScalar(matrix.m, result.m);
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Matrix4x4/InversedAffine", 1000000, [&](uint64_t operations) {
+        Matrix4x4 matrix = model;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(matrix);
+            Matrix4x4 result = matrix.InversedAffine();
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Matrix4x4/Determinant", 1000000, [&](uint64_t operations) {
+        Matrix4x4 matrix = model;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(matrix);
+            float result = matrix.Determinant();
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Matrix4x4/TransformPoint", 4000000, [&](uint64_t operations) {
+        Matrix4x4 matrix = model;
+        Vector3 point(1.0f, 0.5f, -0.25f);
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(matrix);
+            DoNotOptimize(point);
+            Vector3 result = matrix.TransformPoint(point);
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Matrix4x4/TRS", 1000000, [&](uint64_t operations) {
+        Quaternion rotation = Quaternion::FromEuler(Vector3(10.0f, 20.0f, 30.0f));
+        for (uint64_t i = 0; i < operations; i++) {
+            Matrix4x4 result = Matrix4x4::TRS(Vector3(static_cast<float>(i & 15), 0.0f, 0.0f), rotation,
+                                              Vector3(1.0f, 1.0f, 1.0f));
+            DoNotOptimize(result);
+        }
+    });
+
+    const Quaternion from = Quaternion::FromEuler(Vector3(0.0f, 10.0f, 0.0f));
+    const Quaternion to = Quaternion::FromEuler(Vector3(80.0f, 170.0f, -45.0f));
+    runner.Run("Quaternion/Slerp", 4000000, [&](uint64_t operations) {
+        Quaternion a = from;
+        Quaternion b = to;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(a);
+            DoNotOptimize(b);
+            float t = static_cast<float>(i & 1023) * (1.0f / 1023.0f);
+            Quaternion result = Quaternion::Slerp(a, b, t);
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Quaternion/Multiply", 4000000, [&](uint64_t operations) {
+        Quaternion a = from;
+        Quaternion b = to;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(a);
+            DoNotOptimize(b);
+            Quaternion result = a * b;
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Quaternion/RotateVector", 4000000, [&](uint64_t operations) {
+        Quaternion rotation = to;
+        Vector3 vector(1.0f, 0.5f, -0.25f);
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(rotation);
+            DoNotOptimize(vector);
+            Vector3 result = rotation.RotateVector(vector);
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Quaternion/ToMatrix", 4000000, [&](uint64_t operations) {
+        Quaternion rotation = to;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(rotation);
+            Matrix4x4 result = rotation.ToMatrix();
+            DoNotOptimize(result);
+        }
+    });
+
+    // Normalización exacta (sqrt + división) contra rsqrt con un paso de Newton-Raphson
+    runner.Run("VectorRegister/Normalize3", 4000000, [&](uint64_t operations) {
+        VectorRegister value = VectorSet(1.0f, 0.5f, -0.25f, 0.0f);
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(value);
+            VectorRegister result = VectorNormalize3(value);
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("VectorRegister/Normalize3Fast", 4000000, [&](uint64_t operations) {
+        VectorRegister value = VectorSet(1.0f, 0.5f, -0.25f, 0.0f);
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(value);
+            VectorRegister result = VectorNormalize3Fast(value);
+            DoNotOptimize(result);
+        }
+    });
+
+    const Transform parent(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(Vector3(0.0f, 90.0f, 0.0f)),
+                           Vector3(2.0f, 2.0f, 2.0f));
+    const Transform child(Vector3(0.5f, 0.0f, -1.0f), Quaternion::FromEuler(Vector3(15.0f, 0.0f, 5.0f)),
+                          Vector3(1.0f, 1.0f, 1.0f));
+    runner.Run("Transform/Compose", 2000000, [&](uint64_t operations) {
+        Transform a = parent;
+        Transform b = child;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(a);
+            DoNotOptimize(b);
+            Transform result = a * b;
+            DoNotOptimize(result);
+        }
+    });
+
+    runner.Run("Transform/ToMatrix", 2000000, [&](uint64_t operations) {
+        Transform transform = child;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(transform);
+            Matrix4x4 result = transform.ToMatrix();
+            DoNotOptimize(result);
+        }
+    });
+}
+
+void RunBatchBenchmarks(FBenchmarkRunner& runner) {
+    const Matrix4x4 model = Matrix4x4::TRS(Vector3(1.0f, 2.0f, 3.0f),
+                                           Quaternion::FromEuler(Vector3(30.0f, 45.0f, 60.0f)),
+                                           Vector3(1.0f, 2.0f, 0.5f));
+
+    std::vector<Vector3> points(BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        points[i] = Vector3(static_cast<float>(i % 64), static_cast<float>(i / 64), static_cast<float>(i & 7));
+    }
+    std::vector<Vector3> transformedPoints(BATCH_SIZE);
+    std::vector<float> xs(BATCH_SIZE), ys(BATCH_SIZE), zs(BATCH_SIZE);
+    std::vector<float> outXs(BATCH_SIZE), outYs(BATCH_SIZE), outZs(BATCH_SIZE);
+    MathBatch::AoSToSoA(points.data(), xs.data(), ys.data(), zs.data(), BATCH_SIZE);
+
+    // Referencia: un Vector3 por llamada
+    runner.Run("Batch/TransformPointLoop", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                transformedPoints[i] = model.TransformPoint(points[i]);
+            }
+            DoNotOptimize(transformedPoints[0]);
+        }
+    });
+
+    runner.Run("Batch/TransformPoints", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::TransformPoints(model, xs.data(), ys.data(), zs.data(), outXs.data(), outYs.data(),
+                                       outZs.data(), BATCH_SIZE);
+            DoNotOptimize(outXs[0]);
+        }
+    });
+
+    // Conversión + transformación + vuelta, cuando los datos vienen en AoS
+    runner.Run("Batch/TransformPointsAoS", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::AoSToSoA(points.data(), xs.data(), ys.data(), zs.data(), BATCH_SIZE);
+            MathBatch::TransformPoints(model, xs.data(), ys.data(), zs.data(), outXs.data(), outYs.data(),
+                                       outZs.data(), BATCH_SIZE);
+            MathBatch::SoAToAoS(outXs.data(), outYs.data(), outZs.data(), transformedPoints.data(), BATCH_SIZE);
+            DoNotOptimize(transformedPoints[0]);
+        }
+    });
+
+    std::vector<Matrix4x4> children(BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        children[i] = Matrix4x4::Translation(points[i]);
+    }
+    std::vector<Matrix4x4> worldMatrices(BATCH_SIZE);
+
+    runner.Run("Batch/MultiplyMatrixLoop", BATCH_SIZE * 64, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                worldMatrices[i] = model * children[i];
+            }
+            DoNotOptimize(worldMatrices[0]);
+        }
+    });
+
+    runner.Run("Batch/MultiplyMatrices", BATCH_SIZE * 64, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::MultiplyMatrices(model, children.data(), worldMatrices.data(), BATCH_SIZE);
+            DoNotOptimize(worldMatrices[0]);
+        }
+    });
+}
+
+void RunQuaternionBatchBenchmarks(FBenchmarkRunner& runner) {
+    std::mt19937 random(20240605);
+    std::vector<Quaternion> from(BATCH_SIZE), to(BATCH_SIZE), results(BATCH_SIZE);
+    std::vector<float> xs(BATCH_SIZE), ys(BATCH_SIZE), zs(BATCH_SIZE);
+    std::vector<float> outXs(BATCH_SIZE), outYs(BATCH_SIZE), outZs(BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        from[i] = MakeRandomRotation(random);
+        to[i] = MakeRandomRotation(random);
+        xs[i] = static_cast<float>(i % 64);
+        ys[i] = static_cast<float>(i / 64);
+        zs[i] = static_cast<float>(i & 7);
+    }
+    const float t = 0.3f;
+
+    // Referencia: Quaternion::Slerp (acos + sin) por elemento
+    runner.Run("Batch/SlerpLoop", BATCH_SIZE * 64, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                results[i] = Quaternion::Slerp(from[i], to[i], t);
+            }
+            DoNotOptimize(results[0]);
+        }
+    });
+
+    runner.Run("Batch/SlerpQuaternions", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::SlerpQuaternions(from.data(), to.data(), t, results.data(), BATCH_SIZE);
+            DoNotOptimize(results[0]);
+        }
+    });
+
+    runner.Run("Batch/NlerpQuaternions", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::NlerpQuaternions(from.data(), to.data(), t, results.data(), BATCH_SIZE);
+            DoNotOptimize(results[0]);
+        }
+    });
+
+    runner.Run("Batch/NormalizeQuaternions", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::NormalizeQuaternions(from.data(), results.data(), BATCH_SIZE);
+            DoNotOptimize(results[0]);
+        }
+    });
+
+    runner.Run("Batch/RotateVectorLoop", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                Vector3 result = from[i].RotateVector(Vector3(xs[i], ys[i], zs[i]));
+                outXs[i] = result.x;
+                outYs[i] = result.y;
+                outZs[i] = result.z;
+            }
+            DoNotOptimize(outXs[0]);
+        }
+    });
+
+    runner.Run("Batch/RotateVectors", BATCH_SIZE * 256, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::RotateVectors(from.data(), xs.data(), ys.data(), zs.data(), outXs.data(), outYs.data(),
+                                     outZs.data(), BATCH_SIZE);
+            DoNotOptimize(outXs[0]);
+        }
+    });
+
+    std::vector<Matrix4x4> matrices(BATCH_SIZE);
+    runner.Run("Batch/ToMatrixLoop", BATCH_SIZE * 64, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                matrices[i] = from[i].ToMatrix();
+            }
+            DoNotOptimize(matrices[0]);
+        }
+    });
+
+    runner.Run("Batch/QuaternionsToMatrices", BATCH_SIZE * 64, [&](uint64_t operations) {
+        for (uint64_t done = 0; done < operations; done += BATCH_SIZE) {
+            MathBatch::QuaternionsToMatrices(from.data(), matrices.data(), BATCH_SIZE);
+            DoNotOptimize(matrices[0]);
+        }
+    });
+}
+
+void RunRenderCommandBenchmarks(FBenchmarkRunner& runner) {
+    RenderCommandQueue& queue = RenderCommandQueue::Get();
+
+    runner.Run("RenderCommandQueue/EnqueueExecute", RENDER_COMMANDS_PER_BATCH * 256, [&](uint64_t operations) {
+        uint64_t executed = 0;
+        for (uint64_t enqueued = 0; enqueued < operations; ) {
+            for (uint64_t i = 0; i < RENDER_COMMANDS_PER_BATCH && enqueued < operations; i++, enqueued++) {
+                FUniformPayload payload = {};
+                payload.matrix[0] = static_cast<float>(i);
+                queue.Enqueue(ERenderCommandType::UpdateUniforms, [&executed, payload]() {
+                    executed += payload.matrix[0] >= 0.0f ? 1 : 0;
+                });
+            }
+            queue.ExecuteAll();
+        }
+        DoNotOptimize(executed);
+    });
+
+    runner.Run("RenderCommandQueue/ThreadBuffer", RENDER_COMMANDS_PER_BATCH * 256, [&](uint64_t operations) {
+        uint64_t executed = 0;
+        FScopedRenderCommandBuffer commandBuffer;
+        for (uint64_t enqueued = 0; enqueued < operations; ) {
+            for (uint64_t i = 0; i < RENDER_COMMANDS_PER_BATCH && enqueued < operations; i++, enqueued++) {
+                FUniformPayload payload = {};
+                payload.matrix[0] = static_cast<float>(i);
+                queue.Enqueue(ERenderCommandType::UpdateUniforms, [&executed, payload]() {
+                    executed += payload.matrix[0] >= 0.0f ? 1 : 0;
+                });
+            }
+            queue.FlushThreadCommands();
+            queue.ExecuteAll();
+        }
+        DoNotOptimize(executed);
+    });
+}
+
+void RunLogBenchmarks(FBenchmarkRunner& runner) {
+    // Async: solo el call site (capturar los argumentos y publicar el registro en el ring del
+    // thread). Cada registro ocupa menos de 128 bytes, así que ASYNC_LOG_BATCH registros nunca
+    // llenan el ring de 64 KB y el productor no espera al writer. Cada repetición son
+    // ASYNC_LOG_OPERATIONS registros: se mide cada lote de ASYNC_LOG_BATCH y el Flush entre
+    // lotes queda fuera de la medición.
+    constexpr uint64_t ASYNC_LOG_BATCH = 256;
+    constexpr uint64_t ASYNC_LOG_OPERATIONS = ASYNC_LOG_BATCH * 256;
+    auto logBatch = [](uint64_t operations) {
+        for (uint64_t i = 0; i < operations; i++) {
+            UE_LOG_INFO(LogCategories::Core, "Benchmark message %llu (%.3f ms, %s)",
+                        static_cast<unsigned long long>(i), 16.667, "frame");
+        }
+    };
+
+    FLog::SetAsyncMode(true);
+    runner.RunSelfTimed("FLog/Async", ASYNC_LOG_OPERATIONS, [&logBatch](uint64_t operations) {
+        double nanoseconds = 0.0;
+        for (uint64_t logged = 0; logged < operations; logged += ASYNC_LOG_BATCH) {
+            auto startTime = std::chrono::steady_clock::now();
+            logBatch(ASYNC_LOG_BATCH);
+            auto endTime = std::chrono::steady_clock::now();
+            nanoseconds += std::chrono::duration<double, std::nano>(endTime - startTime).count();
+            FLog::Flush();
+        }
+        return nanoseconds;
+    });
+
+    // Vaciado: Flush con ASYNC_LOG_BATCH registros pendientes (el writer formatea y escribe),
+    // por registro. El writer puede haber empezado a vaciar antes de la llamada.
+    runner.Run("FLog/AsyncDrain", ASYNC_LOG_BATCH, [&logBatch] { logBatch(ASYNC_LOG_BATCH); },
+               [](uint64_t) { FLog::Flush(); }, [] {});
+
+    // Filtrado por verbosidad: el mensaje no pasa el nivel activo
+    runner.Run("FLog/Suppressed", 4000000, [](uint64_t operations) {
+        for (uint64_t i = 0; i < operations; i++) {
+            UE_LOG_VERBOSE(LogCategories::Core, "Suppressed message %llu", static_cast<unsigned long long>(i));
+        }
+    });
+
+    FLog::SetAsyncMode(false);
+    runner.Run("FLog/Sync", 10000, [](uint64_t operations) {
+        for (uint64_t i = 0; i < operations; i++) {
+            UE_LOG_INFO(LogCategories::Core, "Benchmark message %llu (%.3f ms, %s)",
+                        static_cast<unsigned long long>(i), 16.667, "frame");
+        }
+        FLog::Flush();
+    });
+}
+
+void RunObjectBenchmarks(FBenchmarkRunner& runner) {
+    runner.Run("UObject/Construct", 500000, [](uint64_t operations) {
+        for (uint64_t i = 0; i < operations; i++) {
+            UBenchmarkObject* object = new UBenchmarkObject();
+            DoNotOptimize(object);
+            delete object;
+        }
+    });
+
+    const UClass* characterClass = &GetBenchmarkCharacterClass();
+    const UClass* baseClass = &GetBenchmarkBaseClass();
+    const UClass* unrelatedClass = &GetBenchmarkUnrelatedClass();
+
+    runner.Run("UClass/IsChildOf", 10000000, [&](uint64_t operations) {
+        uint64_t matches = 0;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(characterClass);
+            matches += characterClass->IsChildOf(baseClass) ? 1 : 0;
+        }
+        DoNotOptimize(matches);
+    });
+
+    runner.Run("UClass/IsChildOf (miss)", 10000000, [&](uint64_t operations) {
+        uint64_t matches = 0;
+        for (uint64_t i = 0; i < operations; i++) {
+            DoNotOptimize(characterClass);
+            matches += characterClass->IsChildOf(unrelatedClass) ? 1 : 0;
+        }
+        DoNotOptimize(matches);
+    });
+}
+
+bool ParseIntOption(const char* argument, const char* option, int& outValue) {
+    size_t optionLength = std::strlen(option);
+    if (std::strncmp(argument, option, optionLength) != 0) {
+        return false;
+    }
+    outValue = std::atoi(argument + optionLength);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    static const char FILTER_OPTION[] = "-Filter=";
+    static const char JSON_OPTION[] = "-Json=";
+
+    int warmupRepetitions = DEFAULT_WARMUP_REPETITIONS;
+    int repetitions = DEFAULT_REPETITIONS;
+    std::string filter;
+    std::string jsonFile;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], FILTER_OPTION, sizeof(FILTER_OPTION) - 1) == 0) {
+            filter = argv[i] + sizeof(FILTER_OPTION) - 1;
+        } else if (std::strncmp(argv[i], JSON_OPTION, sizeof(JSON_OPTION) - 1) == 0) {
+            jsonFile = argv[i] + sizeof(JSON_OPTION) - 1;
+        } else if (!ParseIntOption(argv[i], "-Repetitions=", repetitions) &&
+                   !ParseIntOption(argv[i], "-Warmup=", warmupRepetitions)) {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            std::fprintf(stderr, "Usage: %s [-Filter=Name] [-Repetitions=N] [-Warmup=N] [-Json=file]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // Los mensajes de FLog/* van al fichero: la consola no debe contaminar las mediciones
+    FLog::SetConsoleOutput(false);
+    FLog::Initialize("EngineBenchmarks.log");
+
+    if (!VerifyMathKernels() || !VerifyQuaternionKernels() || !VerifyBatchTransforms() ||
+        !VerifyQuaternionBatches() || !VerifyRenderCommandQueue() || !VerifyConsoleCommands()) {
+        return 1;
+    }
+
+    FBenchmarkRunner runner(warmupRepetitions, repetitions, filter);
+    std::printf("Engine benchmarks: %d warm-up + %d measured repetitions\n\n", warmupRepetitions, repetitions);
+    std::printf("%-36s %12s %12s %12s %12s\n", "Benchmark", "Ops/rep", "Min ns/op", "Median ns/op", "Mops/s");
+
+    RunMathBenchmarks(runner);
+    RunBatchBenchmarks(runner);
+    RunQuaternionBatchBenchmarks(runner);
+    RunRenderCommandBenchmarks(runner);
+    RunLogBenchmarks(runner);
+    RunObjectBenchmarks(runner);
+
+    int exitCode = 0;
+    if (!jsonFile.empty()) {
+        if (runner.WriteJson(jsonFile)) {
+            std::printf("\nResults written to %s\n", jsonFile.c_str());
+        } else {
+            exitCode = 1;
+        }
+    }
+
+    RenderCommandQueue::Get().Shutdown();
+    FLog::Shutdown();
+    return exitCode;
+}
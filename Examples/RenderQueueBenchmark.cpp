@@ -0,0 +1,172 @@
+#include "Core/Log.h"
+#include "Core/Threading/RenderCommandQueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Benchmark de contención: RenderCommandQueue (ring MPSC lock-free con comandos inline)
+// frente a la implementación anterior (mutex + std::queue<std::unique_ptr> + std::function
+// + notify por comando). Cada comando captura una matriz 4x4, como UpdateUniforms.
+// La tercera variante usa FScopedRenderCommandBuffer: un volcado al ring por frame.
+
+namespace {
+
+constexpr int FRAMES = 200;
+constexpr int COMMANDS_PER_FRAME = 256;   // Por productor
+constexpr int REPETITIONS = 5;
+const int PRODUCER_COUNTS[] = { 1, 4, 16 };
+
+// Payload típico de un comando UpdateUniforms (una matriz 4x4)
+struct FUniformPayload {
+    float matrix[16];
+};
+
+// Réplica de la cola anterior (std::function + unique_ptr por comando), para comparar
+struct FLegacyRenderCommand {
+    ERenderCommandType type;
+    std::function<void()> executeFunction;
+    
+    FLegacyRenderCommand(ERenderCommandType cmdType, std::function<void()> func)
+        : type(cmdType), executeFunction(func) {}
+};
+
+class FLegacyRenderCommandQueue {
+public:
+    void Enqueue(ERenderCommandType type, std::function<void()> command) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            commandQueue.push(std::make_unique<FLegacyRenderCommand>(type, command));
+        }
+        conditionVariable.notify_one();
+    }
+
+    void ExecuteAll() {
+        std::queue<std::unique_ptr<FLegacyRenderCommand>> commandsToExecute;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            while (!commandQueue.empty()) {
+                commandsToExecute.push(std::move(commandQueue.front()));
+                commandQueue.pop();
+            }
+        }
+        while (!commandsToExecute.empty()) {
+            auto& command = commandsToExecute.front();
+            if (command && command->executeFunction) {
+                command->executeFunction();
+            }
+            commandsToExecute.pop();
+        }
+    }
+
+    // Ya notifica en cada Enqueue
+    void NotifyCommandsAvailable() {}
+
+private:
+    std::mutex queueMutex;
+    std::queue<std::unique_ptr<FLegacyRenderCommand>> commandQueue;
+    std::condition_variable conditionVariable;
+};
+
+// Devuelve el tiempo total (segundos) para que 'producerCount' threads encolen
+// FRAMES * COMMANDS_PER_FRAME comandos cada uno mientras un consumidor los ejecuta.
+// Con bThreadBuffer cada productor acumula sus comandos y los vuelca una vez por frame.
+template<typename QueueType>
+double RunContention(QueueType& queue, int producerCount, bool bThreadBuffer) {
+    const uint64_t totalCommands = static_cast<uint64_t>(producerCount) * FRAMES * COMMANDS_PER_FRAME;
+    uint64_t executed = 0;  // Solo lo modifica el consumidor
+    std::atomic<bool> bStart{false};
+
+    std::vector<std::thread> producers;
+    producers.reserve(producerCount);
+    for (int p = 0; p < producerCount; p++) {
+        producers.emplace_back([&queue, &executed, &bStart, bThreadBuffer]() {
+            std::optional<FScopedRenderCommandBuffer> commandBuffer;
+            if (bThreadBuffer) {
+                commandBuffer.emplace();
+            }
+            while (!bStart.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int frame = 0; frame < FRAMES; frame++) {
+                for (int i = 0; i < COMMANDS_PER_FRAME; i++) {
+                    FUniformPayload payload = {};
+                    payload.matrix[0] = static_cast<float>(i);
+                    queue.Enqueue(ERenderCommandType::UpdateUniforms, [&executed, payload]() {
+                        executed += payload.matrix[0] >= 0.0f ? 1 : 0;
+                    });
+                }
+                if (bThreadBuffer) {
+                    RenderCommandQueue::Get().FlushThreadCommands();
+                }
+                queue.NotifyCommandsAvailable();
+            }
+        });
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    bStart.store(true, std::memory_order_release);
+
+    while (executed < totalCommands) {
+        queue.ExecuteAll();
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    return std::chrono::duration<double>(endTime - startTime).count();
+}
+
+template<typename QueueType>
+double BestOf(QueueType& queue, int producerCount, bool bThreadBuffer = false) {
+    double best = 0.0;
+    for (int r = 0; r < REPETITIONS; r++) {
+        double seconds = RunContention(queue, producerCount, bThreadBuffer);
+        if (r == 0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    // El logging de ExecuteAll no debe contaminar las mediciones
+    FLog::SetConsoleOutput(false);
+    FLog::SetFileOutput(false);
+
+    std::printf("RenderCommandQueue contention benchmark\n");
+    std::printf("%d frames x %d commands per producer, best of %d\n\n", FRAMES, COMMANDS_PER_FRAME, REPETITIONS);
+    std::printf("%-10s %-18s %14s %14s %10s\n", "Producers", "Backend", "ns/command", "Mcmd/s", "Speedup");
+
+    FLegacyRenderCommandQueue legacyQueue;
+    RenderCommandQueue& ringQueue = RenderCommandQueue::Get();
+
+    for (int producerCount : PRODUCER_COUNTS) {
+        const double totalCommands = static_cast<double>(producerCount) * FRAMES * COMMANDS_PER_FRAME;
+
+        double legacySeconds = BestOf(legacyQueue, producerCount);
+        double ringSeconds = BestOf(ringQueue, producerCount);
+        double bufferedSeconds = BestOf(ringQueue, producerCount, true);
+
+        std::printf("%-10d %-18s %14.1f %14.2f %10s\n", producerCount, "mutex+std::queue",
+                    legacySeconds * 1e9 / totalCommands, totalCommands / legacySeconds / 1e6, "1.00x");
+        std::printf("%-10d %-18s %14.1f %14.2f %9.2fx\n", producerCount, "MPSC ring",
+                    ringSeconds * 1e9 / totalCommands, totalCommands / ringSeconds / 1e6,
+                    legacySeconds / ringSeconds);
+        std::printf("%-10d %-18s %14.1f %14.2f %9.2fx\n", producerCount, "MPSC ring+buffer",
+                    bufferedSeconds * 1e9 / totalCommands, totalCommands / bufferedSeconds / 1e6,
+                    legacySeconds / bufferedSeconds);
+    }
+
+    ringQueue.Shutdown();
+    return 0;
+}
@@ -1,6 +1,9 @@
 #include "Core/Log.h"
 #include "Core/Threading/ThreadManager.h"
 #include "Core/Threading/RenderCommandQueue.h"
+#include "Core/Threading/JobSystem.h"
+#include "Core/Threading/RenderCommandFence.h"
+#include <atomic>
 #include <thread>
 #include <chrono>
 
@@ -111,6 +114,51 @@ int main() {
     UE_LOG_INFO(LogCategories::Core, "Ejecutando comandos pendientes...");
     renderQueue.ExecuteAll();
     
+    // Esperar a que el render thread ejecute un comando concreto
+    ENQUEUE_RENDER_COMMAND(Custom, []() {
+        UE_LOG_INFO(LogCategories::Core, "  ↻ Comando previo al fence ejecutado");
+    });
+    FRenderCommandFence fence;
+    fence.BeginFence();
+    fence.Wait();
+    UE_LOG_INFO(LogCategories::Core, "Fence #%llu completado: %s",
+                static_cast<unsigned long long>(fence.GetSequence()), fence.IsFenceComplete() ? "SÍ" : "NO");
+    
+    // Repartir trabajo en los workers del JobSystem
+    UE_LOG_INFO(LogCategories::Core, "");
+    UE_LOG_INFO(LogCategories::Core, "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+    UE_LOG_INFO(LogCategories::Core, "🧵 DEMOSTRACIÓN: JobSystem (work-stealing)");
+    UE_LOG_INFO(LogCategories::Core, "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+    
+    auto& jobSystem = JobSystem::Get();
+    UE_LOG_INFO(LogCategories::Core, "Workers: %u", jobSystem.GetNumWorkers());
+    
+    std::atomic<uint64_t> parallelSum{0};
+    jobSystem.ParallelFor(10000, 256, [&parallelSum](uint32_t index) {
+        parallelSum.fetch_add(index, std::memory_order_relaxed);
+    });
+    UE_LOG_INFO(LogCategories::Core, "ParallelFor(10000): suma = %llu (esperado 49995000)",
+                static_cast<unsigned long long>(parallelSum.load()));
+    
+    FJobHandle jobHandle = jobSystem.Submit([]() {
+        UE_LOG_INFO(LogCategories::Core, "  ✓ Job ejecutado en worker: %s",
+                    JobSystem::Get().IsInWorkerThread() ? "SÍ" : "NO");
+    });
+    jobSystem.Wait(jobHandle);
+    
+    // Encolar una tarea en el game thread y esperarla
+    UE_LOG_INFO(LogCategories::Core, "");
+    UE_LOG_INFO(LogCategories::Core, "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+    UE_LOG_INFO(LogCategories::Core, "🎯 DEMOSTRACIÓN: ExecuteInGameThread");
+    UE_LOG_INFO(LogCategories::Core, "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+    
+    FTaskHandle gameTask = threadMgr.ExecuteInGameThread([&threadMgr]() {
+        UE_LOG_INFO(LogCategories::Core, "  ✓ Tarea ejecutada en game thread: %s",
+                    threadMgr.IsInGameThread() ? "SÍ" : "NO");
+    });
+    gameTask.Wait();
+    UE_LOG_INFO(LogCategories::Core, "Tarea completada: %s", gameTask.IsComplete() ? "SÍ" : "NO");
+    
     // Esperar un poco para ver los ticks
     UE_LOG_INFO(LogCategories::Core, "");
     UE_LOG_INFO(LogCategories::Core, "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
@@ -3,7 +3,14 @@
 #include "RHI/vulkan_cube.h"
 #include "Core/Log.h"
 #include "Core/Timer.h"
+#include "Core/Profiler.h"
+#include "Core/Stats.h"
+#include "Core/MemoryStats.h"
 #include "Core/Threading/RenderCommandQueue.h"
+#include "Core/Threading/RenderState.h"
+#include "Core/Threading/ThreadManager.h"
+#include "Core/Object/UObject.h"
+#include "Core/Object/UClass.h"
 #include "UI/UIManager.h"
 #include "UI/Panels/DebugOverlay.h"
 #include "UI/Panels/StatsPanel.h"
@@ -20,6 +27,16 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 // Resolution settings
 const uint32_t MIN_WIDTH = 800;
@@ -29,6 +46,44 @@ const uint32_t DEFAULT_HEIGHT = 1080;
 const uint32_t MAX_WIDTH = 1920;
 const uint32_t MAX_HEIGHT = 1080;
 
+// Register the editor panels and windows shown by default (main loop and headless mode)
+void RegisterDefaultPanels() {
+    // Initialize UI Manager
+    UI::UIManager::Get().Initialize();
+    
+    // Registrar paneles por defecto
+    UI::UIManager::Get().RegisterPanel("DebugOverlay", std::make_shared<UI::DebugOverlay>());
+    UI::UIManager::Get().RegisterWindow("StatsPanel", std::make_shared<UI::StatsPanel>());
+    UI::UIManager::Get().RegisterWindow("ObjectHierarchy", std::make_shared<UI::ObjectHierarchyPanel>());
+    
+    // Registrar paneles estilo UE5
+    UI::UIManager::Get().RegisterWindow("Viewport", std::make_shared<UI::ViewportPanel>());
+    UI::UIManager::Get().RegisterWindow("Details", std::make_shared<UI::DetailsPanel>());
+    UI::UIManager::Get().RegisterWindow("ContentBrowser", std::make_shared<UI::ContentBrowserPanel>());
+    // Los comandos de consola ("log ...", "profile ...") se escriben en la terminal
+    // hasta que el panel tenga entrada de texto en eGUI
+    auto consolePanel = std::make_shared<UI::ConsolePanel>();
+    consolePanel->StartTerminalInput();
+    UI::UIManager::Get().RegisterWindow("Console", consolePanel);
+    
+    // Registrar componentes UE5
+    UI::UIManager::Get().RegisterPanel("MenuBar", std::make_shared<UI::MenuBar>());
+    UI::UIManager::Get().RegisterPanel("StatusBar", std::make_shared<UI::StatusBar>());
+    
+    // Mostrar paneles principales por defecto (todos visibles desde el inicio)
+    UI::UIManager::Get().ShowWindow("Viewport");
+    UI::UIManager::Get().ShowWindow("Details");
+    UI::UIManager::Get().ShowWindow("ContentBrowser");
+    UI::UIManager::Get().ShowWindow("Console");
+    UI::UIManager::Get().ShowWindow("StatsPanel");
+    UI::UIManager::Get().ShowWindow("ObjectHierarchy");
+    UI::UIManager::Get().SetShowDebugOverlay(true);
+    UI::UIManager::Get().ShowWindow("Viewport");
+    UI::UIManager::Get().ShowWindow("Details");
+    UI::UIManager::Get().ShowWindow("ContentBrowser");
+    UI::UIManager::Get().ShowWindow("Console");
+}
+
 class App {
 public:
     void run() {
@@ -217,36 +272,7 @@ private:
         UE_LOG_INFO(LogCategories::Core, "Controls: WASD - Move | Mouse - Look | ESC - Lock/Unlock Mouse | F11 - Maximize/Restore | TAB - Toggle UI");
         UE_LOG_INFO(LogCategories::Core, "Supported resolutions: %dx%d to %dx%d", MIN_WIDTH, MIN_HEIGHT, MAX_WIDTH, MAX_HEIGHT);
         
-        // Initialize UI Manager
-        UI::UIManager::Get().Initialize();
-        
-        // Registrar paneles por defecto
-        UI::UIManager::Get().RegisterPanel("DebugOverlay", std::make_shared<UI::DebugOverlay>());
-        UI::UIManager::Get().RegisterWindow("StatsPanel", std::make_shared<UI::StatsPanel>());
-        UI::UIManager::Get().RegisterWindow("ObjectHierarchy", std::make_shared<UI::ObjectHierarchyPanel>());
-        
-        // Registrar paneles estilo UE5
-        UI::UIManager::Get().RegisterWindow("Viewport", std::make_shared<UI::ViewportPanel>());
-        UI::UIManager::Get().RegisterWindow("Details", std::make_shared<UI::DetailsPanel>());
-        UI::UIManager::Get().RegisterWindow("ContentBrowser", std::make_shared<UI::ContentBrowserPanel>());
-        UI::UIManager::Get().RegisterWindow("Console", std::make_shared<UI::ConsolePanel>());
-        
-        // Registrar componentes UE5
-        UI::UIManager::Get().RegisterPanel("MenuBar", std::make_shared<UI::MenuBar>());
-        UI::UIManager::Get().RegisterPanel("StatusBar", std::make_shared<UI::StatusBar>());
-        
-        // Mostrar paneles principales por defecto (todos visibles desde el inicio)
-        UI::UIManager::Get().ShowWindow("Viewport");
-        UI::UIManager::Get().ShowWindow("Details");
-        UI::UIManager::Get().ShowWindow("ContentBrowser");
-        UI::UIManager::Get().ShowWindow("Console");
-        UI::UIManager::Get().ShowWindow("StatsPanel");
-        UI::UIManager::Get().ShowWindow("ObjectHierarchy");
-        UI::UIManager::Get().SetShowDebugOverlay(true);
-        UI::UIManager::Get().ShowWindow("Viewport");
-        UI::UIManager::Get().ShowWindow("Details");
-        UI::UIManager::Get().ShowWindow("ContentBrowser");
-        UI::UIManager::Get().ShowWindow("Console");
+        RegisterDefaultPanels();
         
         // Initialize global frame timer
         GFrameTimer = &frameTimer;
@@ -260,6 +286,7 @@ private:
         uint32_t loopIteration = 0;
         while (!glfwWindowShouldClose(window)) {
             loopIteration++;
+            FLogFlightRecorder::MarkFrame("MainThread", loopIteration);
             if (loopIteration == 1) {
                 UE_LOG_INFO(LogCategories::Core, "First iteration of main loop starting...");
             }
@@ -484,6 +511,9 @@ private:
                 UE_LOG_INFO(LogCategories::Core, "Updating UI data...");
             }
             try {
+                const FFrameStats& frameStats = frameTimer.GetFrameStats();
+                FFrameTimeSummary windowFrameTimes = frameStats.GetWindowSummary();
+                
                 auto debugOverlay = std::dynamic_pointer_cast<UI::DebugOverlay>(UI::UIManager::Get().GetPanel("DebugOverlay"));
                 if (debugOverlay) {
                     debugOverlay->SetFPS(frameTimer.GetFPS());
@@ -495,6 +525,7 @@ private:
                     debugOverlay->SetCameraPosition(pos.x, pos.y, pos.z);
                     
                     debugOverlay->SetRenderQueueSize(RenderCommandQueue::Get().Size());
+                    debugOverlay->SetFrameTimeStats(windowFrameTimes);
                 }
                 
                 auto statsPanel = std::dynamic_pointer_cast<UI::StatsPanel>(UI::UIManager::Get().GetWindow("StatsPanel"));
@@ -505,6 +536,8 @@ private:
                         frameTimer.GetFrameCount(),
                         frameTimer.GetTotalTime()
                     );
+                    statsPanel->UpdateFrameTimeStats(windowFrameTimes, frameStats.GetSessionSummary(),
+                                                     frameStats.GetHitchBudgetMS());
                 }
                 
                 // Actualizar StatusBar
@@ -610,6 +643,8 @@ private:
                 UE_LOG_ERROR(LogCategories::Core, "Exception in frameTimer.LimitFrameRate(): %s", e.what());
                 break;
             }
+            FProfiler::EndFrame();
+            FStats::AdvanceFrame();
             
             // Print stats every second
             frameCount++;
@@ -629,6 +664,8 @@ private:
         }
         
         UE_LOG_INFO(LogCategories::Core, "Main loop ended. Total frames: %llu", frameTimer.GetFrameCount());
+        UE_LOG_INFO(LogCategories::Core, "%s", FFrameStats::FormatSummary(frameTimer.GetFrameStats().GetSessionSummary()).c_str());
+        frameTimer.GetFrameStats().WriteJson("Engine.framestats.json", "MainThread");
         try {
             cube.waitDeviceIdle();
             UE_LOG_INFO(LogCategories::Core, "Vulkan device idle, cleanup complete");
@@ -648,13 +685,462 @@ private:
     }
 };
 
-int main() {
+// ============================================================================
+// Headless soak benchmark: VulkanCube --headless --frames=N [--report=file]
+// ============================================================================
+//
+// Runs the engine without a window, Vulkan device or presentation, so it also
+// runs in CI on machines without a GPU. The game thread ticks the camera and a
+// set of UObjects and sends one render command per object; the render thread
+// executes them, computes the per-object MVP matrices, updates the UI panels and
+// tessellates the eGUI frame. Both threads run unthrottled for N render frames,
+// then a JSON report is written: frame-time percentiles, CPU time per stat and
+// per thread, heap allocations and peak RSS.
+
+struct FHeadlessOptions {
+    bool bEnabled = false;
+    uint32_t frameCount = 1000;
+    std::string reportFile = "Engine.headless.json";
+};
+
+FHeadlessOptions ParseHeadlessOptions(int argc, char* argv[]) {
+    static const char FRAMES_OPTION[] = "--frames=";
+    static const char REPORT_OPTION[] = "--report=";
+    
+    FHeadlessOptions options;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i] == nullptr) {
+            continue;
+        }
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            options.bEnabled = true;
+        } else if (std::strncmp(argv[i], FRAMES_OPTION, sizeof(FRAMES_OPTION) - 1) == 0) {
+            options.frameCount = static_cast<uint32_t>(std::strtoul(argv[i] + sizeof(FRAMES_OPTION) - 1, nullptr, 10));
+        } else if (std::strncmp(argv[i], REPORT_OPTION, sizeof(REPORT_OPTION) - 1) == 0) {
+            options.reportFile = argv[i] + sizeof(REPORT_OPTION) - 1;
+        }
+    }
+    if (options.frameCount == 0) {
+        options.frameCount = 1;
+    }
+    return options;
+}
+
+DECLARE_CYCLE_STAT("Actor tick", STAT_HeadlessActorTick, Game);
+DECLARE_CYCLE_STAT("Send render transforms", STAT_HeadlessSendTransforms, Game);
+DECLARE_CYCLE_STAT("Scene proxies", STAT_HeadlessSceneProxies, Render);
+DECLARE_CYCLE_STAT("UI update", STAT_HeadlessUIUpdate, UI);
+
+// UObject ticked every game frame: spins in place
+class USoakActor : public UObject {
+public:
+    USoakActor(const Vector3& position, float spinSpeed)
+        : transform(position)
+        , spinSpeed(spinSpeed)
+        , angle(0.0f)
+    {
+    }
+    
+    virtual const UClass* GetClass() const override { return StaticClass(); }
+    virtual const char* GetClassTypeName() const override { return "USoakActor"; }
+    
+    virtual void Tick(float deltaTime) override {
+        angle += spinSpeed * deltaTime;
+        transform.SetEulerRotation(Vector3(angle * 0.5f, angle, 0.0f));
+    }
+    
+    Matrix4x4 GetWorldMatrix() const { return transform.ToMatrix(); }
+    
+    static const UClass* StaticClass() {
+        static const UClass classInfo("USoakActor");
+        return &classInfo;
+    }
+
+private:
+    Transform transform;
+    float spinSpeed;    // Degrees per second
+    float angle;
+};
+
+class HeadlessApp {
+public:
+    explicit HeadlessApp(const FHeadlessOptions& options)
+        : options(options)
+    {
+    }
+    
+    bool run() {
+        init();
+        
+        // Count allocations only while the frames run
+        FMemoryStats::SetAllocationTracking(true);
+        auto startTime = std::chrono::steady_clock::now();
+        ThreadManager::Get().Initialize();
+        
+        // The render thread flags the last frame; the main thread has nothing else to do
+        while (!bFinished.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        
+        ThreadManager::Get().Shutdown();
+        wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        FMemoryStats::SetAllocationTracking(false);
+        
+        // Stats of the last game frame, plus what the render thread recorded after it
+        accumulateStats();
+        FStats::AdvanceFrame();
+        accumulateStats();
+        
+        UE_LOG_INFO(LogCategories::Core, "Headless run finished: %llu render frames in %.2f s",
+                    static_cast<unsigned long long>(renderTimer.GetFrameCount()), wallSeconds);
+        UE_LOG_INFO(LogCategories::Core, "%s", FFrameStats::FormatSummary(renderTimer.GetFrameStats().GetSessionSummary()).c_str());
+        
+        bool bReportWritten = writeReport();
+        cleanup();
+        return bReportWritten;
+    }
+
+private:
+    static constexpr uint32_t ACTOR_COUNT = 1024;
+    
+    // Game -> render snapshot (same pattern as main_threaded.cpp)
+    struct FSceneRenderState {
+        Matrix4x4 viewMatrix;
+        Matrix4x4 projMatrix;
+        Vector3 cameraPosition;
+        uint64_t gameFrameNumber = 0;
+    };
+    
+    // Sum of every frame snapshot of a stat over the run
+    struct FStatTotal {
+        const char* name;
+        const char* group;
+        EStatType type;
+        EStatUnit unit;
+        double total = 0.0;
+        double peak = 0.0;
+        double last = 0.0;
+        uint64_t callCount = 0;
+    };
+    
+    FHeadlessOptions options;
+    Camera camera;
+    FFrameTimer gameTimer;
+    FFrameTimer renderTimer;
+    std::vector<std::unique_ptr<USoakActor>> actors;
+    
+    TRenderState<FSceneRenderState> sceneRenderState;
+    std::vector<Matrix4x4> renderTransforms;    // Render thread only (written by render commands)
+    float sceneChecksum = 0.0f;
+    
+    std::atomic<bool> bFinished{false};
+    double wallSeconds = 0.0;
+    
+    // Game thread while running, main thread after Shutdown
+    std::vector<FStatTotal> statTotals;
+    uint64_t statFrames = 0;
+    uint64_t lastStatFrameNumber = 0;
+    
+    void init() {
+        UE_LOG_INFO(LogCategories::Core, "Headless mode: %u frames, %u actors, report: %s",
+                    options.frameCount, ACTOR_COUNT, options.reportFile.c_str());
+        
+        camera.SetPosition(Vector3(0.0f, 10.0f, -40.0f));
+        camera.SetPerspective(45.0f, static_cast<float>(DEFAULT_WIDTH) / static_cast<float>(DEFAULT_HEIGHT), 0.1f, 1000.0f);
+        camera.SetMouseSensitivity(1.0f);
+        camera.SetMode(ECameraMode::Orbit);
+        
+        // Grid of actors around the origin
+        actors.reserve(ACTOR_COUNT);
+        std::vector<UObject*> objectList;
+        objectList.reserve(ACTOR_COUNT);
+        for (uint32_t i = 0; i < ACTOR_COUNT; i++) {
+            Vector3 position(static_cast<float>(i % 32) * 2.0f - 32.0f, 0.0f, static_cast<float>(i / 32) * 2.0f - 32.0f);
+            actors.push_back(std::make_unique<USoakActor>(position, 30.0f + static_cast<float>(i % 7) * 10.0f));
+            objectList.push_back(actors.back().get());
+        }
+        renderTransforms.resize(ACTOR_COUNT);
+        
+        // UI panels and eGUI without a renderer: eGUI still builds and tessellates every frame
+        RegisterDefaultPanels();
+        auto objectHierarchy = std::dynamic_pointer_cast<UI::ObjectHierarchyPanel>(UI::UIManager::Get().GetWindow("ObjectHierarchy"));
+        if (objectHierarchy) {
+            objectHierarchy->UpdateObjectList(objectList);
+        }
+        if (!UI::EGUIWrapper::Get().InitializeHeadless(DEFAULT_WIDTH, DEFAULT_HEIGHT)) {
+            UE_LOG_WARNING(LogCategories::UI, "Headless mode continues without eGUI tessellation");
+        }
+        
+        auto& threadMgr = ThreadManager::Get();
+        threadMgr.SetGameThreadTickFunction([this](float deltaTime) {
+            gameThreadTick(deltaTime);
+        });
+        threadMgr.SetRenderThreadTickFunction([this](float deltaTime) {
+            renderThreadTick(deltaTime);
+        });
+        
+        // Unthrottled: the benchmark measures how fast frames can be produced
+        threadMgr.SetTargetGameFPS(0.0f);
+        threadMgr.SetTargetRenderFPS(0.0f);
+        threadMgr.SetMaxFramesInFlight(2);
+        
+        GFrameTimer = &renderTimer;
+        renderTimer.SetFrameLimiting(false);
+        gameTimer.SetFrameLimiting(false);
+    }
+    
+    void gameThreadTick(float deltaTime) {
+        accumulateStats();
+        
+        // Frames past the last one only wait for Shutdown
+        if (bFinished.load(std::memory_order_relaxed)) {
+            return;
+        }
+        gameTimer.Tick();
+        
+        // Scripted camera: slow orbit around the grid
+        camera.Orbit(deltaTime * 0.5f, 0.0f);
+        camera.Update(deltaTime);
+        
+        {
+            SCOPE_CYCLE_COUNTER(STAT_HeadlessActorTick);
+            for (auto& actor : actors) {
+                if (actor->IsEnabled()) {
+                    actor->Tick(deltaTime);
+                }
+            }
+        }
+        
+        // One command per actor, like a per-primitive transform update
+        {
+            SCOPE_CYCLE_COUNTER(STAT_HeadlessSendTransforms);
+            for (size_t i = 0; i < actors.size(); i++) {
+                Matrix4x4* renderTransform = &renderTransforms[i];
+                Matrix4x4 worldMatrix = actors[i]->GetWorldMatrix();
+                RenderCommandQueue::Get().Enqueue(ERenderCommandType::UpdateUniforms, [renderTransform, worldMatrix]() {
+                    *renderTransform = worldMatrix;
+                });
+            }
+        }
+        
+        FSceneRenderState& state = sceneRenderState.GetWriteState();
+        state.viewMatrix = camera.GetViewMatrix();
+        state.projMatrix = camera.GetProjectionMatrix();
+        state.cameraPosition = camera.GetPosition();
+        state.gameFrameNumber = ThreadManager::Get().GetGameFrameNumber();
+        sceneRenderState.Publish();
+    }
+    
+    void renderThreadTick(float deltaTime) {
+        if (bFinished.load(std::memory_order_relaxed)) {
+            return;
+        }
+        
+        // The frame's commands were executed by ThreadManager before this tick
+        renderTimer.Tick();
+        const FSceneRenderState& state = sceneRenderState.GetReadState();
+        
+        // What drawFrame would upload: one MVP per actor
+        {
+            SCOPE_CYCLE_COUNTER(STAT_HeadlessSceneProxies);
+            Matrix4x4 viewProjection = state.projMatrix * state.viewMatrix;
+            for (const Matrix4x4& worldMatrix : renderTransforms) {
+                Matrix4x4 mvp = viewProjection * worldMatrix;
+                sceneChecksum += mvp[15];
+            }
+        }
+        
+        UI::EGUIWrapper::Get().NewFrame();
+        {
+            SCOPE_CYCLE_COUNTER(STAT_HeadlessUIUpdate);
+            const FFrameStats& frameStats = renderTimer.GetFrameStats();
+            FFrameTimeSummary windowFrameTimes = frameStats.GetWindowSummary();
+            
+            auto debugOverlay = std::dynamic_pointer_cast<UI::DebugOverlay>(UI::UIManager::Get().GetPanel("DebugOverlay"));
+            if (debugOverlay) {
+                debugOverlay->SetFPS(renderTimer.GetFPS());
+                debugOverlay->SetDeltaTime(deltaTime);
+                debugOverlay->SetFrameCount(renderTimer.GetFrameCount());
+                debugOverlay->SetTotalTime(renderTimer.GetTotalTime());
+                debugOverlay->SetCameraPosition(state.cameraPosition.x, state.cameraPosition.y, state.cameraPosition.z);
+                debugOverlay->SetRenderQueueSize(RenderCommandQueue::Get().Size());
+                debugOverlay->SetFrameTimeStats(windowFrameTimes);
+            }
+            
+            auto statsPanel = std::dynamic_pointer_cast<UI::StatsPanel>(UI::UIManager::Get().GetWindow("StatsPanel"));
+            if (statsPanel) {
+                statsPanel->UpdateStats(renderTimer.GetFPS(), deltaTime, renderTimer.GetFrameCount(),
+                                        renderTimer.GetTotalTime());
+                statsPanel->UpdateFrameTimeStats(windowFrameTimes, frameStats.GetSessionSummary(),
+                                                 frameStats.GetHitchBudgetMS());
+            }
+            
+            UI::UIManager::Get().Update(deltaTime);
+            UI::UIManager::Get().Render();
+        }
+        
+        // Tessellation only: there is no command buffer to record into
+        UI::EGUIWrapper::Get().UpdateEngineState(renderTimer.GetFPS(), deltaTime, renderTimer.GetFrameCount(),
+                                                 renderTimer.GetTotalTime());
+        UI::EGUIWrapper::Get().Render(VK_NULL_HANDLE, DEFAULT_WIDTH, DEFAULT_HEIGHT);
+        
+        if (ThreadManager::Get().GetRenderFrameNumber() + 1 >= options.frameCount) {
+            bFinished.store(true, std::memory_order_release);
+        }
+    }
+    
+    // Fold the last FStats frame snapshot into the run totals (once per snapshot)
+    void accumulateStats() {
+        uint64_t frameNumber = FStats::GetFrameNumber();
+        if (frameNumber == lastStatFrameNumber) {
+            return;
+        }
+        lastStatFrameNumber = frameNumber;
+        statFrames++;
+        
+        for (const FStatValue& stat : FStats::GetFrameSnapshot()) {
+            auto it = std::find_if(statTotals.begin(), statTotals.end(), [&stat](const FStatTotal& total) {
+                return total.name == stat.name;
+            });
+            if (it == statTotals.end()) {
+                statTotals.push_back({stat.name, stat.group, stat.type, stat.unit});
+                it = statTotals.end() - 1;
+            }
+            it->total += stat.value;
+            it->peak = std::max(it->peak, stat.value);
+            it->last = stat.value;
+            it->callCount += stat.callCount;
+        }
+    }
+    
+    static void appendJsonString(std::string& json, const char* text) {
+        json += '"';
+        for (const char* c = text; *c != '\0'; c++) {
+            if (*c == '"' || *c == '\\') {
+                json += '\\';
+            }
+            json += *c;
+        }
+        json += '"';
+    }
+    
+    bool writeReport() const {
+        const uint64_t renderFrames = std::max<uint64_t>(renderTimer.GetFrameCount(), 1);
+        const double perStatFrame = 1.0 / static_cast<double>(std::max<uint64_t>(statFrames, 1));
+        char buffer[512];
+        
+        std::string json = "{\"mode\":\"headless\",";
+        std::snprintf(buffer, sizeof(buffer),
+                      "\"frames\":%llu,\"actors\":%u,\"wallSeconds\":%.3f,\"averageFPS\":%.2f,\n",
+                      static_cast<unsigned long long>(renderTimer.GetFrameCount()), ACTOR_COUNT, wallSeconds,
+                      wallSeconds > 0.0 ? static_cast<double>(renderTimer.GetFrameCount()) / wallSeconds : 0.0);
+        json += buffer;
+        
+        json += "\"renderThread\":" + renderTimer.GetFrameStats().ToJson("RenderThread");
+        json += ",\"gameThread\":" + gameTimer.GetFrameStats().ToJson("GameThread");
+        
+        const ThreadManager& threadMgr = ThreadManager::Get();
+        std::snprintf(buffer, sizeof(buffer),
+                      ",\"threadCPUSeconds\":{\"game\":%.3f,\"render\":%.3f,\"workers\":%.3f},\n\"stats\":[",
+                      threadMgr.GetThreadCPUTime(EThreadType::Game), threadMgr.GetThreadCPUTime(EThreadType::Render),
+                      threadMgr.GetThreadCPUTime(EThreadType::Worker));
+        json += buffer;
+        
+        // Cycle stats: total and per-frame milliseconds; counters: total and per frame;
+        // accumulators: last and peak value
+        for (size_t i = 0; i < statTotals.size(); i++) {
+            const FStatTotal& stat = statTotals[i];
+            json += i == 0 ? "\n{\"name\":" : ",\n{\"name\":";
+            appendJsonString(json, stat.name);
+            json += ",\"group\":";
+            appendJsonString(json, stat.group);
+            if (stat.type == EStatType::Cycle) {
+                std::snprintf(buffer, sizeof(buffer),
+                              ",\"type\":\"cycle\",\"totalMS\":%.3f,\"perFrameMS\":%.4f,\"peakMS\":%.3f,\"calls\":%llu}",
+                              stat.total, stat.total * perStatFrame, stat.peak,
+                              static_cast<unsigned long long>(stat.callCount));
+            } else if (stat.type == EStatType::Counter) {
+                std::snprintf(buffer, sizeof(buffer),
+                              ",\"type\":\"counter\",\"unit\":\"%s\",\"total\":%.0f,\"perFrame\":%.2f,\"peak\":%.0f}",
+                              stat.unit == EStatUnit::Bytes ? "bytes" : "count", stat.total,
+                              stat.total * perStatFrame, stat.peak);
+            } else {
+                std::snprintf(buffer, sizeof(buffer),
+                              ",\"type\":\"accumulator\",\"unit\":\"%s\",\"value\":%.0f,\"peak\":%.0f}",
+                              stat.unit == EStatUnit::Bytes ? "bytes" : "count", stat.last, stat.peak);
+            }
+            json += buffer;
+        }
+        
+        FMemorySnapshot memory = FMemoryStats::GetSnapshot();
+        std::snprintf(buffer, sizeof(buffer),
+                      "],\n\"memory\":{\"allocations\":%llu,\"frees\":%llu,\"allocatedBytes\":%llu,"
+                      "\"allocationsPerFrame\":%.2f,\"allocatedBytesPerFrame\":%.1f,"
+                      "\"peakRSSBytes\":%llu,\"currentRSSBytes\":%llu}}\n",
+                      static_cast<unsigned long long>(memory.allocationCount),
+                      static_cast<unsigned long long>(memory.freeCount),
+                      static_cast<unsigned long long>(memory.allocatedBytes),
+                      static_cast<double>(memory.allocationCount) / static_cast<double>(renderFrames),
+                      static_cast<double>(memory.allocatedBytes) / static_cast<double>(renderFrames),
+                      static_cast<unsigned long long>(FMemoryStats::GetPeakResidentBytes()),
+                      static_cast<unsigned long long>(FMemoryStats::GetCurrentResidentBytes()));
+        json += buffer;
+        
+        std::ofstream file(options.reportFile, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file.is_open()) {
+            UE_LOG_ERROR(LogCategories::Core, "Could not write the headless report to %s", options.reportFile.c_str());
+            return false;
+        }
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        UE_LOG_INFO(LogCategories::Core, "Headless report written to %s (checksum %.3f)", options.reportFile.c_str(),
+                    sceneChecksum);
+        return true;
+    }
+    
+    void cleanup() {
+        UI::EGUIWrapper::Get().Shutdown();
+        UI::UIManager::Get().Shutdown();
+        actors.clear();
+    }
+};
+
+int main(int argc, char* argv[]) {
     // Initialize logging system
     FLog::Initialize("Engine.log");
-    FLog::SetVerbosity(ELogVerbosity::Display);
+    FLog::SetVerbosity(ELogVerbosity::Log);
+    
+    // Per-category verbosity, e.g. -LogCmds="LogRender Verbose, LogRHI Warning"
+    FLog::ParseCommandLine(argc, argv);
     FLog::SetConsoleOutput(true);
     FLog::SetFileOutput(true);
     
+    // Log calls only format into a per-thread ring; a writer thread does the I/O
+    FLog::SetAsyncMode(true);
+    
+    // Recent records (down to Verbose) and frame markers are dumped on Fatal or a crash,
+    // so only Fatal needs to flush synchronously
+    FLogFlightRecorder::Initialize("Engine-crash.ulog", ELogVerbosity::Verbose);
+    FLog::SetSyncFlushVerbosity(ELogVerbosity::Fatal);
+    
+    // -Profile=N captures N frames into a Chrome trace (-ProfileFile=path, default Engine.trace.json)
+    FProfiler::SetCurrentThreadName("MainThread");
+    FProfiler::ParseCommandLine(argc, argv);
+    
+    // --headless --frames=N: soak benchmark without window or GPU (see HeadlessApp)
+    FHeadlessOptions headlessOptions = ParseHeadlessOptions(argc, argv);
+    if (headlessOptions.bEnabled) {
+        bool bSuccess = false;
+        try {
+            HeadlessApp app(headlessOptions);
+            bSuccess = app.run();
+        } catch (const std::exception& e) {
+            UE_LOG_ERROR(LogCategories::Core, "Exception occurred in headless mode: %s", e.what());
+        }
+        FProfiler::StopCapture();
+        FLog::Shutdown();
+        return bSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    
     {
         SCOPED_TIMER("EngineInitialization");
         
@@ -679,6 +1165,7 @@ int main() {
     }
     
     UE_LOG_INFO(LogCategories::Core, "=== Vulkan Engine Shutting Down ===");
+    FProfiler::StopCapture();
     FLog::Shutdown();
 
     return EXIT_SUCCESS;
@@ -3,15 +3,18 @@
 #include "RHI/vulkan_cube.h"
 #include "Core/Log.h"
 #include "Core/Timer.h"
+#include "Core/Profiler.h"
 #include "Core/Threading/ThreadManager.h"
 #include "Core/Threading/RenderCommandQueue.h"
+#include "Core/Threading/RenderState.h"
 #include "Rendering/Camera.h"
 #include "Input/InputManager.h"
 
 #include <iostream>
 #include <stdexcept>
 #include <atomic>
-#include <mutex>
+#include <algorithm>
+#include <cmath>
 
 // Resolution settings
 const uint32_t MIN_WIDTH = 800;
@@ -34,12 +37,15 @@ public:
 private:
     GLFWwindow* window;
     VulkanCube cube;
-    FFrameTimer frameTimer;
     FFrameTimer renderTimer;
     Camera camera;
     bool bShowStats = true;
     bool bCameraLocked = false;
-    bool bFramebufferResized = false;
+    // Tamaño del framebuffer publicado por el main thread (callback de GLFW). Game y render
+    // thread no pueden llamar a GLFW: lo leen de aquí (0x0 = ventana minimizada).
+    std::atomic<int> framebufferWidth{0};
+    std::atomic<int> framebufferHeight{0};
+    std::atomic<bool> bFramebufferResized{false};
     int currentWidth = DEFAULT_WIDTH;
     int currentHeight = DEFAULT_HEIGHT;
     bool bIsFullscreen = false;
@@ -48,11 +54,30 @@ private:
     int windowedWidth = DEFAULT_WIDTH;
     int windowedHeight = DEFAULT_HEIGHT;
     
-    // Thread-safe shared data
-    std::mutex cameraDataMutex;
-    Matrix4x4 sharedViewMatrix;
-    Matrix4x4 sharedProjMatrix;
-    std::atomic<bool> bMatricesDirty{false};
+    // Estado que el game thread publica cada frame para el render thread.
+    // TRenderState: triple buffer lock-free, el render thread siempre lee el último
+    // snapshot completo sin bloquear al game thread.
+    struct FCameraRenderState {
+        Matrix4x4 viewMatrix;
+        Matrix4x4 projMatrix;
+    };
+    struct FObjectRenderState {
+        Matrix4x4 cubeTransform;
+    };
+    struct FUIRenderState {
+        bool bShowStats = true;
+        bool bCameraLocked = false;
+        uint64_t gameFrameNumber = 0;
+        float gameDeltaTime = 0.0f;
+    };
+    struct FSceneRenderState {
+        FCameraRenderState camera;
+        FObjectRenderState objects;
+        FUIRenderState ui;
+    };
+    TRenderState<FSceneRenderState> sceneRenderState;
+    float cubeRotationTime = 0.0f;
+    FTimer renderStatsTimer;
 
     void initWindow() {
         UE_LOG_INFO(LogCategories::Core, "Initializing GLFW...");
@@ -109,6 +134,13 @@ private:
     void initVulkan() {
         cube.initVulkan(window);
         
+        // Desde aquí el swap chain se recrea con el tamaño que publica el main thread
+        int fbWidth = 0, fbHeight = 0;
+        glfwGetFramebufferSize(window, &fbWidth, &fbHeight);
+        framebufferWidth = fbWidth;
+        framebufferHeight = fbHeight;
+        cube.SetFramebufferSize(fbWidth, fbHeight);
+        
         float aspectRatio = (float)currentWidth / (float)currentHeight;
         camera.SetMode(ECameraMode::FPS);
         camera.SetPosition(Vector3(0.0f, 0.0f, -3.0f));
@@ -137,6 +169,11 @@ private:
         
         threadMgr.SetTargetGameFPS(60.0f);
         threadMgr.SetTargetRenderFPS(60.0f);
+        threadMgr.SetMaxFramesInFlight(2);
+        
+        GFrameTimer = &renderTimer;
+        renderTimer.SetTargetFPS(60.0f);
+        renderTimer.SetFrameLimiting(false);
         
         threadMgr.Initialize();
         
@@ -149,33 +186,67 @@ private:
         
         // Manejar input y cámara
         handleInput();
-        updateCamera(deltaTime);
-        
-        // Actualizar matrices compartidas (thread-safe)
-        {
-            std::lock_guard<std::mutex> lock(cameraDataMutex);
-            sharedViewMatrix = camera.GetViewMatrix();
-            sharedProjMatrix = camera.GetProjectionMatrix();
-            bMatricesDirty = true;
+        if (bFramebufferResized.exchange(false, std::memory_order_acquire)) {
+            updateCameraAspectRatio();
         }
+        updateCamera(deltaTime);
         
-        // Encolar comando para actualizar matrices en render thread
-        ENQUEUE_RENDER_COMMAND(UpdateCamera, [this]() {
-            if (bMatricesDirty) {
-                std::lock_guard<std::mutex> lock(cameraDataMutex);
-                cube.UpdateMatrices(sharedViewMatrix.Data(), sharedProjMatrix.Data());
-                bMatricesDirty = false;
-            }
-        });
+        // Rotación del cubo (simulación en el game thread)
+        cubeRotationTime += deltaTime;
+        
+        // Publicar el snapshot de este frame para el render thread
+        FSceneRenderState& state = sceneRenderState.GetWriteState();
+        state.camera.viewMatrix = camera.GetViewMatrix();
+        state.camera.projMatrix = camera.GetProjectionMatrix();
+        BuildCubeTransform(cubeRotationTime, state.objects.cubeTransform);
+        state.ui.bShowStats = bShowStats;
+        state.ui.bCameraLocked = bCameraLocked;
+        state.ui.gameFrameNumber = ThreadManager::Get().GetGameFrameNumber();
+        state.ui.gameDeltaTime = deltaTime;
+        sceneRenderState.Publish();
+    }
+    
+    // Rotación en Y y luego en X (column-major, igual que la rotación por defecto de VulkanCube)
+    static void BuildCubeTransform(float time, Matrix4x4& outTransform) {
+        float cosT = cosf(time * 1.0f);
+        float sinT = sinf(time * 1.0f);
+        float cosX = cosf(time * 0.5f);
+        float sinX = sinf(time * 0.5f);
+        
+        const float model[16] = {
+            cosT,           sinX * sinT,    -cosX * sinT,   0.0f,
+            0.0f,           cosX,           sinX,           0.0f,
+            sinT,           -sinX * cosT,   cosX * cosT,    0.0f,
+            0.0f,           0.0f,           0.0f,           1.0f
+        };
+        std::copy(model, model + 16, outTransform.Data());
     }
     
     void renderThreadTick(float deltaTime) {
-        // Ejecutar comandos de renderizado
-        RenderCommandQueue::Get().ExecuteAll();
+        // Los comandos del frame ya fueron ejecutados por ThreadManager antes de este tick
+        renderTimer.Tick();
+        
+        // Último snapshot publicado por el game thread (sin locks)
+        const FSceneRenderState& state = sceneRenderState.GetReadState();
+        cube.UpdateMatrices(state.camera.viewMatrix.Data(), state.camera.projMatrix.Data());
+        cube.UpdateModelMatrix(state.objects.cubeTransform.Data());
+        
+        // Dibujar frame N mientras el game thread simula N+1.
+        // Ventana minimizada: no hay swap chain válido hasta que el main thread publique
+        // un tamaño distinto de 0 (recreateSwapChain no puede esperar eventos aquí)
+        if (framebufferWidth.load(std::memory_order_relaxed) > 0 &&
+            framebufferHeight.load(std::memory_order_relaxed) > 0) {
+            cube.drawFrame();
+        }
         
-        // Renderizar frame (esto debe estar en render thread)
-        // Nota: GLFW requiere que glfwPollEvents esté en el main thread,
-        // así que hacemos render desde main loop pero usando comandos encolados
+        if (state.ui.bShowStats && renderStatsTimer.HasTimeElapsed(1.0)) {
+            UE_LOG_INFO(LogCategories::Core, "%s | Render Frame: %llu | Game Frame: %llu | Render Queue: %zu",
+                        renderTimer.GetStatsString().c_str(),
+                        static_cast<unsigned long long>(ThreadManager::Get().GetRenderFrameNumber()),
+                        static_cast<unsigned long long>(state.ui.gameFrameNumber),
+                        RenderCommandQueue::Get().Size());
+            renderStatsTimer.Reset();
+        }
     }
     
     void handleInput() {
@@ -201,6 +272,18 @@ private:
         }
     }
     
+    // Game thread: aspect ratio de la cámara con el último tamaño publicado
+    void updateCameraAspectRatio() {
+        int width = framebufferWidth.load(std::memory_order_relaxed);
+        int height = framebufferHeight.load(std::memory_order_relaxed);
+        if (width <= 0 || height <= 0) {
+            return;
+        }
+        width = std::clamp(width, static_cast<int>(MIN_WIDTH), static_cast<int>(MAX_WIDTH));
+        height = std::clamp(height, static_cast<int>(MIN_HEIGHT), static_cast<int>(MAX_HEIGHT));
+        camera.SetAspectRatio((float)width / (float)height);
+    }
+    
     void updateCamera(float deltaTime) {
         // Actualizar cámara con input
         camera.SetInputState(InputManager::Get().GetCameraInputState());
@@ -258,48 +341,24 @@ private:
         UE_LOG_INFO(LogCategories::Core, "Game Thread and Render Thread are running separately");
         UE_LOG_INFO(LogCategories::Core, "Controls: WASD - Move | Mouse - Look | ESC - Lock/Unlock Mouse | F11 - Maximize/Restore");
         
-        GFrameTimer = &frameTimer;
-        frameTimer.SetTargetFPS(60.0f);
-        frameTimer.SetFrameLimiting(false);
-        
-        uint32_t frameCount = 0;
-        FTimer statsTimer;
-        
-        // Main loop (maneja GLFW events y render)
-        // Nota: GLFW requiere que glfwPollEvents y present estén en el main thread
+        // Main loop: solo eventos de GLFW (deben estar en el main thread).
+        // Game thread simula y render thread dibuja, en pipeline.
+        // Nota: GLFW requiere que los eventos y las consultas de ventana (glfwWaitEvents,
+        // glfwGetFramebufferSize) estén en el main thread: el callback de resize publica el
+        // tamaño y el render thread solo lo lee (VulkanCube::SetFramebufferSize).
         while (!glfwWindowShouldClose(window)) {
-            frameTimer.Tick();
-            
-            // Poll events (debe estar en main thread)
-            glfwPollEvents();
-            
-            // Render frame (usando comandos encolados desde game/render threads)
-            // Ejecutar comandos pendientes
-            RenderCommandQueue::Get().ExecuteAll();
-            
-            // Draw frame (Vulkan present debe estar en el mismo contexto que la creación)
-            cube.drawFrame();
-            
-            frameTimer.LimitFrameRate();
-            
-            // Stats
-            frameCount++;
-            if (statsTimer.HasTimeElapsed(1.0)) {
-                if (bShowStats) {
-                    Vector3 pos = camera.GetPosition();
-                    size_t queueSize = RenderCommandQueue::Get().Size();
-                    UE_LOG_INFO(LogCategories::Core, "%s | Camera: (%.2f, %.2f, %.2f) | Render Queue: %zu", 
-                                frameTimer.GetStatsString().c_str(), pos.x, pos.y, pos.z, queueSize);
-                }
-                statsTimer.Reset();
-            }
+            glfwWaitEventsTimeout(0.005);
         }
         
-        UE_LOG_INFO(LogCategories::Core, "Main loop ended. Total frames: %llu", frameTimer.GetFrameCount());
-        
         // Shutdown threads
         ThreadManager::Get().Shutdown();
         
+        UE_LOG_INFO(LogCategories::Core, "Main loop ended. Total frames: %llu", renderTimer.GetFrameCount());
+        
+        // El render thread ya terminó: se pueden leer sus estadísticas de frame
+        UE_LOG_INFO(LogCategories::Core, "%s", FFrameStats::FormatSummary(renderTimer.GetFrameStats().GetSessionSummary()).c_str());
+        renderTimer.GetFrameStats().WriteJson("Engine.framestats.json", "RenderThread");
+        
         cube.waitDeviceIdle();
     }
 
@@ -310,23 +369,30 @@ private:
         glfwTerminate();
     }
     
+    // Main thread (desde glfwWaitEventsTimeout): publicar el tamaño para game y render thread.
+    // También 0x0 al minimizar, para que el render thread deje de dibujar.
     static void framebufferResizeCallback(GLFWwindow* window, int width, int height) {
         auto app = reinterpret_cast<App*>(glfwGetWindowUserPointer(window));
-        if (app && width > 0 && height > 0) {
+        if (!app) {
+            return;
+        }
+        
+        app->framebufferWidth.store(width, std::memory_order_relaxed);
+        app->framebufferHeight.store(height, std::memory_order_relaxed);
+        app->bFramebufferResized.store(true, std::memory_order_release);
+        app->cube.SetFramebufferSize(width, height);
+        
+        if (width > 0 && height > 0) {
             if (width < static_cast<int>(MIN_WIDTH)) width = MIN_WIDTH;
             if (height < static_cast<int>(MIN_HEIGHT)) height = MIN_HEIGHT;
             if (width > static_cast<int>(MAX_WIDTH)) width = MAX_WIDTH;
             if (height > static_cast<int>(MAX_HEIGHT)) height = MAX_HEIGHT;
             
-            app->bFramebufferResized = true;
             app->currentWidth = width;
             app->currentHeight = height;
-            app->cube.MarkFramebufferResized();
-            
-            float aspectRatio = (float)width / (float)height;
-            app->camera.SetAspectRatio(aspectRatio);
             
-            UE_LOG_INFO(LogCategories::Core, "Framebuffer resized to %dx%d (Aspect: %.2f)", width, height, aspectRatio);
+            UE_LOG_INFO(LogCategories::Core, "Framebuffer resized to %dx%d (Aspect: %.2f)", width, height,
+                        (float)width / (float)height);
         }
     }
     
@@ -341,12 +407,27 @@ private:
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
     FLog::Initialize("Engine.log");
-    FLog::SetVerbosity(ELogVerbosity::Display);
+    FLog::SetVerbosity(ELogVerbosity::Log);
+    
+    // Per-category verbosity, e.g. -LogCmds="LogRender Verbose, LogRHI Warning"
+    FLog::ParseCommandLine(argc, argv);
     FLog::SetConsoleOutput(true);
     FLog::SetFileOutput(true);
     
+    // Log calls only format into a per-thread ring; a writer thread does the I/O
+    FLog::SetAsyncMode(true);
+    
+    // Recent records (down to Verbose) and frame markers are dumped on Fatal or a crash,
+    // so only Fatal needs to flush synchronously
+    FLogFlightRecorder::Initialize("Engine-crash.ulog", ELogVerbosity::Verbose);
+    FLog::SetSyncFlushVerbosity(ELogVerbosity::Fatal);
+    
+    // -Profile=N captures N frames into a Chrome trace (-ProfileFile=path, default Engine.trace.json)
+    FProfiler::SetCurrentThreadName("MainThread");
+    FProfiler::ParseCommandLine(argc, argv);
+    
     {
         SCOPED_TIMER("EngineInitialization");
         
@@ -371,6 +452,7 @@ int main() {
     }
     
     UE_LOG_INFO(LogCategories::Core, "=== Vulkan Engine Shutting Down ===");
+    FProfiler::StopCapture();
     FLog::Shutdown();
 
     return EXIT_SUCCESS;
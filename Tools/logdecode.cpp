@@ -0,0 +1,181 @@
+#include "Core/Log.h"
+#include "Core/LogArgs.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// logdecode - Converts a binary log (FLog::SetBinaryFileOutput) into the same text
+// format as Engine.log.
+//
+//   logdecode Engine.ulog               -> stdout
+//   logdecode Engine.ulog Engine.log    -> file
+
+namespace {
+
+class FBinaryLogReader {
+public:
+    explicit FBinaryLogReader(const std::vector<char>& data) : cursor(data.data()), end(data.data() + data.size()) {}
+
+    template<typename T>
+    bool Read(T& value) {
+        if (sizeof(T) > static_cast<size_t>(end - cursor)) {
+            return false;
+        }
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    bool ReadBytes(size_t size, const char*& out) {
+        if (size > static_cast<size_t>(end - cursor)) {
+            return false;
+        }
+        out = cursor;
+        cursor += size;
+        return true;
+    }
+
+    bool IsAtEnd() const { return cursor >= end; }
+
+private:
+    const char* cursor;
+    const char* end;
+};
+
+void AppendLinePrefix(std::string& out, const LogBinaryFile::FFileHeader& header, int64_t timestamp,
+                      uint8_t verbosity, const std::string& category) {
+    int64_t wallNanoseconds = header.systemAnchor + (timestamp - header.steadyAnchor);
+    std::time_t seconds = static_cast<std::time_t>(wallNanoseconds / 1000000000);
+    long long milliseconds = (wallNanoseconds / 1000000) % 1000;
+
+    std::tm timeInfo{};
+    #ifdef _WIN32
+    localtime_s(&timeInfo, &seconds);
+    #else
+    localtime_r(&seconds, &timeInfo);
+    #endif
+
+    char prefix[256];
+    int length = std::snprintf(prefix, sizeof(prefix), "[%02d:%02d:%02d.%03lld] %s: %s: ",
+                               timeInfo.tm_hour, timeInfo.tm_min, timeInfo.tm_sec, milliseconds,
+                               category.c_str(), FLog::GetVerbosityString(static_cast<ELogVerbosity>(verbosity)));
+    if (length > 0) {
+        out.append(prefix, std::min(static_cast<size_t>(length), sizeof(prefix) - 1));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <binary log> [output text file]\n", argv[0]);
+        return 1;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input.is_open()) {
+        std::fprintf(stderr, "Could not open %s\n", argv[1]);
+        return 1;
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    FBinaryLogReader reader(data);
+    LogBinaryFile::FFileHeader header{};
+    if (!reader.Read(header) || std::memcmp(header.magic, LogBinaryFile::MAGIC, sizeof(header.magic)) != 0) {
+        std::fprintf(stderr, "%s is not a binary engine log\n", argv[1]);
+        return 1;
+    }
+    if (header.version != LogBinaryFile::VERSION) {
+        std::fprintf(stderr, "Unsupported binary log version %u (expected %u)\n", header.version, LogBinaryFile::VERSION);
+        return 1;
+    }
+
+    FILE* output = stdout;
+    if (argc >= 3) {
+        output = std::fopen(argv[2], "w");
+        if (output == nullptr) {
+            std::fprintf(stderr, "Could not create %s\n", argv[2]);
+            return 1;
+        }
+    }
+
+    std::unordered_map<uint32_t, std::string> strings;
+    auto lookup = [&strings](uint32_t id) -> const std::string& {
+        static const std::string unknown = "<unknown>";
+        auto found = strings.find(id);
+        return found != strings.end() ? found->second : unknown;
+    };
+
+    std::string line;
+    size_t recordCount = 0;
+    bool bTruncated = false;
+
+    while (!reader.IsAtEnd()) {
+        LogBinaryFile::ELogFileEntry entryType;
+        if (!reader.Read(entryType)) {
+            bTruncated = true;
+            break;
+        }
+
+        if (entryType == LogBinaryFile::ELogFileEntry::String) {
+            uint32_t id = 0;
+            uint32_t length = 0;
+            const char* bytes = nullptr;
+            if (!reader.Read(id) || !reader.Read(length) || !reader.ReadBytes(length, bytes)) {
+                bTruncated = true;
+                break;
+            }
+            strings[id].assign(bytes, length);
+            continue;
+        }
+
+        int64_t timestamp = 0;
+        uint32_t threadIndex = 0;
+        uint32_t categoryId = 0;
+        uint32_t formatId = 0;
+        uint8_t verbosity = 0;
+        uint32_t payloadLength = 0;
+        const char* payload = nullptr;
+
+        bool bValid = reader.Read(timestamp) && reader.Read(threadIndex) && reader.Read(categoryId);
+        if (bValid && entryType == LogBinaryFile::ELogFileEntry::Deferred) {
+            bValid = reader.Read(formatId);
+        } else if (bValid && entryType != LogBinaryFile::ELogFileEntry::Text) {
+            std::fprintf(stderr, "Unknown entry type %u, stopping\n", static_cast<unsigned>(entryType));
+            bTruncated = true;
+            break;
+        }
+        bValid = bValid && reader.Read(verbosity) && reader.Read(payloadLength) &&
+                 reader.ReadBytes(payloadLength, payload);
+        if (!bValid) {
+            bTruncated = true;
+            break;
+        }
+
+        line.clear();
+        AppendLinePrefix(line, header, timestamp, verbosity, lookup(categoryId));
+        if (entryType == LogBinaryFile::ELogFileEntry::Deferred) {
+            LogArgs::FormatDeferred(line, lookup(formatId).c_str(),
+                                    reinterpret_cast<const uint8_t*>(payload), payloadLength);
+        } else {
+            line.append(payload, payloadLength);
+        }
+        line.push_back('\n');
+        std::fwrite(line.data(), 1, line.size(), output);
+        recordCount++;
+    }
+
+    if (output != stdout) {
+        std::fclose(output);
+    }
+
+    std::fprintf(stderr, "%zu records, %zu bytes%s\n", recordCount, data.size(),
+                 bTruncated ? " (truncated log: last entry incomplete)" : "");
+    return 0;
+}